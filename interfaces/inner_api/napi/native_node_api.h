@@ -98,6 +98,141 @@ NAPI_EXTERN napi_status napi_wrap_async_finalizer(napi_env env,
                                                   void* finalize_hint,
                                                   napi_ref* result,
                                                   size_t native_binding_size);
+// Same as napi_wrap_async_finalizer, but finalize_cb may run on several background threads at the same time,
+// with env nullptr. For finalizers that only release thread-safe native resources.
+NAPI_EXTERN napi_status napi_wrap_concurrent_finalizer(napi_env env,
+                                                       napi_value js_object,
+                                                       void* native_object,
+                                                       napi_finalize finalize_cb,
+                                                       void* finalize_hint,
+                                                       napi_ref* result,
+                                                       size_t native_binding_size);
+typedef struct {
+    uint64_t packs;                 // finalizer packs run on the JS thread
+    uint64_t finalizers;            // finalizers run in those packs
+    uint64_t last_pack_us;
+    uint64_t max_pack_us;
+    uint64_t total_pack_us;
+    uint64_t concurrent_shards;     // shards of concurrent finalizers run on background threads
+    uint64_t concurrent_finalizers;
+    uint64_t max_shard_us;
+    uint64_t slices;                // slices the packs were run in, between loop iterations or in idle periods
+    uint64_t idle_slices;
+    uint64_t max_slice_us;
+    uint64_t sync_drains;           // queued packs run at once under memory pressure
+    uint64_t backlog;               // finalizers still queued after the last slice
+    uint64_t async_batches;         // batches of async finalizers run on the uv thread pool
+    uint64_t async_finalizers;
+    uint64_t max_async_batch_us;
+    uint64_t async_sync_batches;    // batches run on the JS thread because async finalization fell behind
+    uint64_t async_backlog;         // async finalizers not run yet
+} napi_finalizer_stats;
+// Timing of the finalizers of |env|, the root env for contexts.
+NAPI_EXTERN napi_status napi_get_finalizer_stats(napi_env env, napi_finalizer_stats* result);
+typedef struct {
+    uint64_t binding_objects;       // live objects created with a native binding size
+    uint64_t binding_bytes;
+    int64_t external_bytes;         // running total of napi_adjust_external_memory
+    uint64_t peak_bytes;            // highest binding_bytes + external_bytes seen
+    uint64_t gc_requests;           // GCs requested because external memory grew
+} napi_native_memory_info;
+// Native memory pinned by the JS objects of |env|, the root env for contexts.
+NAPI_EXTERN napi_status napi_get_native_memory_info(napi_env env, napi_native_memory_info* result);
+// Text report of the native memory per module and of the |max_entries| largest finalize callbacks, copied like
+// napi_get_value_string_utf8: with buf nullptr, result receives the full length.
+NAPI_EXTERN napi_status napi_dump_native_memory(napi_env env,
+                                                size_t max_entries,
+                                                char* buf,
+                                                size_t bufsize,
+                                                size_t* result);
+// Samples 1 in interval references created in env and its contexts together with the native code that created them.
+// interval 0 stops sampling and drops the samples. With capture_js_stack the JS stack of the first sample of a site
+// is kept as well.
+NAPI_EXTERN napi_status napi_set_reference_sampling(napi_env env, uint32_t interval, bool capture_js_stack);
+// Text report of the max_sites sites with most sampled references not deleted yet, copied like
+// napi_dump_native_memory.
+NAPI_EXTERN napi_status napi_dump_reference_sites(napi_env env,
+                                                  size_t max_sites,
+                                                  char* buf,
+                                                  size_t bufsize,
+                                                  size_t* result);
+// Text report of the runtime owned references of |env| grouped by finalize callback, the max_entries largest groups
+// first, copied like napi_dump_native_memory.
+NAPI_EXTERN napi_status napi_dump_references_by_finalizer(napi_env env,
+                                                          size_t max_entries,
+                                                          char* buf,
+                                                          size_t bufsize,
+                                                          size_t* result);
+// Strong references kept in a table of env and named by 32-bit ids, lighter than napi_strong_ref for caches of many
+// objects. 0 is never a valid handle and a deleted handle stays invalid when its slot is reused. Handles still in use
+// are released with the env. JS thread only.
+typedef uint32_t napi_strong_handle;
+NAPI_EXTERN napi_status napi_create_strong_handle(napi_env env, napi_value value, napi_strong_handle* result);
+NAPI_EXTERN napi_status napi_get_strong_handle_value(napi_env env, napi_strong_handle handle, napi_value* result);
+NAPI_EXTERN napi_status napi_set_strong_handle_value(napi_env env, napi_strong_handle handle, napi_value value);
+NAPI_EXTERN napi_status napi_delete_strong_handle(napi_env env, napi_strong_handle handle);
+// Native keys mapped to JS values that are held weakly. Entries of collected values leave the table during the GC,
+// after it the callback receives all their keys in one call. JS thread only, delete tables before their env.
+typedef struct napi_weak_table__* napi_weak_table;
+typedef void (*napi_weak_table_callback)(napi_env env,
+                                         napi_weak_table table,
+                                         void* const* collected_keys,
+                                         size_t count,
+                                         void* data);
+NAPI_EXTERN napi_status napi_create_weak_table(napi_env env,
+                                               napi_weak_table_callback callback,
+                                               void* data,
+                                               napi_weak_table* result);
+// Replaces the entry of key if there is one.
+NAPI_EXTERN napi_status napi_weak_table_set(napi_env env, napi_weak_table table, void* key, napi_value value);
+// result is nullptr when key has no entry.
+NAPI_EXTERN napi_status napi_weak_table_get(napi_env env, napi_weak_table table, void* key, napi_value* result);
+NAPI_EXTERN napi_status napi_weak_table_delete(napi_env env, napi_weak_table table, void* key);
+NAPI_EXTERN napi_status napi_weak_table_size(napi_env env, napi_weak_table table, size_t* result);
+// Pending callbacks of the table are dropped.
+NAPI_EXTERN napi_status napi_delete_weak_table(napi_env env, napi_weak_table table);
+// Converts the arguments of a callback into native values in one call, in place of napi_get_cb_info followed by
+// napi_typeof and napi_get_value_* per argument. format has one letter per argument, followed in the variadic list by
+// its output:
+//   b bool*, i int32_t*, u uint32_t*, l int64_t*, d double*
+//   s char* buf, size_t bufsize, size_t* length: UTF-8 copy truncated like napi_get_value_string_utf8, length gets
+//     the full length in bytes without the terminator, so the copy was truncated when it is not below bufsize.
+//     buf may be nullptr to only read length, length may be nullptr when buf is not
+//   o napi_value*: object or function, f napi_value*: function, v napi_value*: any value
+// Arguments after '|' are optional, when missing or undefined their outputs are left as they are. Spaces are ignored
+// and extra arguments are not read. Stops at the first argument of the wrong type with its napi_*_expected status,
+// and with napi_invalid_arg at a missing required argument, an unknown letter or a nullptr output.
+NAPI_EXTERN napi_status napi_get_cb_args(napi_env env, napi_callback_info cbinfo, const char* format, ...);
+// A property name with a callsite info in every env, for names read or written over and over. Declare accessors
+// static and zero initialized, NAPI_NAMED_ACCESSOR("name"), and never change them. Each env creates the key and the
+// callsite info of an accessor on first use and keeps them until it is destroyed.
+typedef struct {
+    const char* name;   // UTF-8, must outlive every env that uses the accessor
+    uint32_t id;        // assigned on first use
+} napi_named_accessor;
+#define NAPI_NAMED_ACCESSOR(name) { (name), 0 }
+// Same as napi_get_named_property and napi_set_named_property, through the inline cache of accessor in env.
+NAPI_EXTERN napi_status napi_get_named_property_cached(napi_env env,
+                                                      napi_value object,
+                                                      napi_named_accessor* accessor,
+                                                      napi_value* result);
+NAPI_EXTERN napi_status napi_set_named_property_cached(napi_env env,
+                                                      napi_value object,
+                                                      napi_named_accessor* accessor,
+                                                      napi_value value);
+// Reads or writes property_count properties of object in one call, values[i] is the property of accessors[i]. Like
+// napi_create_object_with_named_properties for objects that already exist, with the keys and inline caches of the
+// accessors. Stops at the first property whose getter or setter throws.
+NAPI_EXTERN napi_status napi_get_named_properties(napi_env env,
+                                                 napi_value object,
+                                                 size_t property_count,
+                                                 napi_named_accessor* accessors,
+                                                 napi_value* values);
+NAPI_EXTERN napi_status napi_set_named_properties(napi_env env,
+                                                 napi_value object,
+                                                 size_t property_count,
+                                                 napi_named_accessor* accessors,
+                                                 const napi_value* values);
 NAPI_EXTERN napi_status napi_create_external_with_size(napi_env env,
                                                        void* data,
                                                        napi_finalize finalize_cb,
@@ -226,6 +361,16 @@ NAPI_EXTERN napi_status napi_send_cancelable_event(napi_env env,
  * @return napi_status Return cancel event status
  */
 NAPI_EXTERN napi_status napi_cancel_event(napi_env env, uint64_t handleId, const char* name);
+/*
+ * @brief Get the wakeup counters of the uv path used by napi_send_event and napi_send_cancelable_event
+ *
+ * @param env The native engine.
+ * @param sent Number of events that woke up the JS Thread loop.
+ * @param elided Number of events that found a wakeup already pending and skipped it.
+ *
+ * @return napi_status Return get stats status
+ */
+NAPI_EXTERN napi_status napi_get_event_wakeup_stats(napi_env env, uint64_t* sent, uint64_t* elided);
 NAPI_EXTERN napi_status napi_open_fast_native_scope(napi_env env, napi_fast_native_scope* scope);
 NAPI_EXTERN napi_status napi_close_fast_native_scope(napi_env env, napi_fast_native_scope scope);
 NAPI_EXTERN napi_status napi_get_shared_array_buffer_info(napi_env env,
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_INTERFACES_INNER_API_NAPI_NATIVE_NODE_BINDING_H
+#define FOUNDATION_ACE_NAPI_INTERFACES_INNER_API_NAPI_NATIVE_NODE_BINDING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "js_native_api.h"
+#include "native_common.h"
+#include "native_node_api.h"
+
+// Callbacks generated from the signature of plain C++ functions.
+//
+//     int32_t Measure(double width, std::string_view text);
+//     NapiBinding::DefineFunctions(env, exports, {
+//         NapiBinding::Function<Measure>("measure"),
+//     });
+//
+// The format of napi_get_cb_args is built from the parameter types at compile time, so all numbers and strings are
+// converted in one call without napi_value handles. Strings are copied into a buffer on the stack of the callback and
+// viewed by std::string_view parameters, only strings longer than it are read again and copied to the heap. A
+// conversion that fails throws the error of napi_get_last_error_info and the function is not called.
+// Parameters: bool, int32_t, uint32_t, int64_t, double, napi_value, std::string_view, std::string.
+// Results: void and the same types.
+namespace NapiBinding {
+template<typename T>
+struct ArgTraits;
+
+template<typename T, char format>
+struct ScalarArgTraits {
+    using Storage = T;
+    static constexpr char FORMAT = format;
+
+    static std::tuple<T*> Output(Storage& storage)
+    {
+        return { &storage };
+    }
+    static bool Load(napi_env, napi_callback_info, size_t, Storage&)
+    {
+        return true;
+    }
+    static T Get(Storage& storage)
+    {
+        return storage;
+    }
+};
+
+template<>
+struct ArgTraits<bool> : ScalarArgTraits<bool, 'b'> {};
+template<>
+struct ArgTraits<int32_t> : ScalarArgTraits<int32_t, 'i'> {};
+template<>
+struct ArgTraits<uint32_t> : ScalarArgTraits<uint32_t, 'u'> {};
+template<>
+struct ArgTraits<int64_t> : ScalarArgTraits<int64_t, 'l'> {};
+template<>
+struct ArgTraits<double> : ScalarArgTraits<double, 'd'> {};
+template<>
+struct ArgTraits<napi_value> : ScalarArgTraits<napi_value, 'v'> {};
+
+struct StringArg {
+    static constexpr size_t INLINE_SIZE = 128;
+
+    // full length in bytes, the buffer holds a truncated copy when it is not below INLINE_SIZE
+    size_t length = 0;
+    std::string_view view;
+    std::string overflow;
+    char buffer[INLINE_SIZE];
+};
+
+template<>
+struct ArgTraits<std::string_view> {
+    using Storage = StringArg;
+    static constexpr char FORMAT = 's';
+
+    static std::tuple<char*, size_t, size_t*> Output(Storage& storage)
+    {
+        return { storage.buffer, StringArg::INLINE_SIZE, &storage.length };
+    }
+    // A string that did not fit is read again from argument |index|.
+    static bool Load(napi_env env, napi_callback_info info, size_t index, Storage& storage)
+    {
+        if (storage.length < StringArg::INLINE_SIZE) {
+            storage.view = std::string_view(storage.buffer, storage.length);
+            return true;
+        }
+        size_t argc = index + 1;
+        std::vector<napi_value> argv(argc, nullptr);
+        size_t copied = 0;
+        storage.overflow.resize(storage.length);
+        if (napi_get_cb_info(env, info, &argc, argv.data(), nullptr, nullptr) != napi_ok ||
+            napi_get_value_string_utf8(env, argv[index], storage.overflow.data(), storage.length + 1, &copied) !=
+            napi_ok) {
+            return false;
+        }
+        storage.overflow.resize(copied);
+        storage.view = storage.overflow;
+        return true;
+    }
+    static std::string_view Get(Storage& storage)
+    {
+        return storage.view;
+    }
+};
+
+template<>
+struct ArgTraits<std::string> : ArgTraits<std::string_view> {
+    static std::string Get(Storage& storage)
+    {
+        return std::string(storage.view);
+    }
+};
+
+template<typename T>
+struct ResultTraits;
+
+template<>
+struct ResultTraits<bool> {
+    static napi_value ToValue(napi_env env, bool value)
+    {
+        napi_value result = nullptr;
+        napi_get_boolean(env, value, &result);
+        return result;
+    }
+};
+
+template<>
+struct ResultTraits<int32_t> {
+    static napi_value ToValue(napi_env env, int32_t value)
+    {
+        napi_value result = nullptr;
+        napi_create_int32(env, value, &result);
+        return result;
+    }
+};
+
+template<>
+struct ResultTraits<uint32_t> {
+    static napi_value ToValue(napi_env env, uint32_t value)
+    {
+        napi_value result = nullptr;
+        napi_create_uint32(env, value, &result);
+        return result;
+    }
+};
+
+template<>
+struct ResultTraits<int64_t> {
+    static napi_value ToValue(napi_env env, int64_t value)
+    {
+        napi_value result = nullptr;
+        napi_create_int64(env, value, &result);
+        return result;
+    }
+};
+
+template<>
+struct ResultTraits<double> {
+    static napi_value ToValue(napi_env env, double value)
+    {
+        napi_value result = nullptr;
+        napi_create_double(env, value, &result);
+        return result;
+    }
+};
+
+template<>
+struct ResultTraits<napi_value> {
+    static napi_value ToValue(napi_env env, napi_value value)
+    {
+        return value;
+    }
+};
+
+template<>
+struct ResultTraits<std::string_view> {
+    static napi_value ToValue(napi_env env, std::string_view value)
+    {
+        napi_value result = nullptr;
+        napi_create_string_utf8(env, value.data(), value.size(), &result);
+        return result;
+    }
+};
+
+template<>
+struct ResultTraits<std::string> : ResultTraits<std::string_view> {};
+
+template<typename F>
+struct Invoker;
+
+template<typename R, typename... Args>
+struct Invoker<R (*)(Args...)> {
+    template<R (*func)(Args...)>
+    static napi_value Call(napi_env env, napi_callback_info info)
+    {
+        return Call<func>(env, info, std::index_sequence_for<Args...>());
+    }
+
+    template<R (*func)(Args...), size_t... I>
+    static napi_value Call(napi_env env, napi_callback_info info, std::index_sequence<I...>)
+    {
+        static constexpr char format[] = { ArgTraits<std::decay_t<Args>>::FORMAT..., '\0' };
+        std::tuple<typename ArgTraits<std::decay_t<Args>>::Storage...> storage;
+        // a format letter may take several outputs, 's' takes a buffer, its size and the length
+        auto outputs = std::tuple_cat(ArgTraits<std::decay_t<Args>>::Output(std::get<I>(storage))...);
+        napi_status status = std::apply([env, info](auto... output) {
+            return napi_get_cb_args(env, info, format, output...);
+        }, outputs);
+        if (status != napi_ok || !(ArgTraits<std::decay_t<Args>>::Load(env, info, I, std::get<I>(storage)) && ...)) {
+            GET_AND_THROW_LAST_ERROR(env);
+            return nullptr;
+        }
+        if constexpr (std::is_void_v<R>) {
+            func(ArgTraits<std::decay_t<Args>>::Get(std::get<I>(storage))...);
+            return nullptr;
+        } else {
+            return ResultTraits<std::decay_t<R>>::ToValue(env,
+                func(ArgTraits<std::decay_t<Args>>::Get(std::get<I>(storage))...));
+        }
+    }
+};
+
+template<typename R, typename... Args>
+struct Invoker<R (*)(Args...) noexcept> : Invoker<R (*)(Args...)> {};
+
+// The napi_callback of |func|.
+template<auto func>
+napi_value Callback(napi_env env, napi_callback_info info)
+{
+    return Invoker<std::remove_cv_t<decltype(func)>>::template Call<func>(env, info);
+}
+
+// Property descriptor of |func| as a method |name|, like DECLARE_NAPI_FUNCTION.
+template<auto func>
+constexpr napi_property_descriptor Function(const char* name)
+{
+    return DECLARE_NAPI_FUNCTION(name, Callback<func>);
+}
+
+// Defines all functions on |object| with one napi_define_properties call.
+inline napi_status DefineFunctions(napi_env env,
+                                   napi_value object,
+                                   std::initializer_list<napi_property_descriptor> functions)
+{
+    return napi_define_properties(env, object, functions.size(), functions.begin());
+}
+} // namespace NapiBinding
+
+#endif /* FOUNDATION_ACE_NAPI_INTERFACES_INNER_API_NAPI_NATIVE_NODE_BINDING_H */
@@ -79,6 +79,33 @@ typedef void (*napi_detach_finalize_callback)(void* detachedObject, void* finali
 NAPI_EXTERN napi_status node_api_get_module_file_name(napi_env env, const char** result);
 NAPI_EXTERN napi_status napi_run_script_path(napi_env env, const char* path, napi_value* result);
 NAPI_EXTERN napi_status napi_queue_async_work_with_qos(napi_env env, napi_async_work work, napi_qos_t qos);
+// Run the execute callbacks of napi_queue_async_work_with_qos on a process-wide work stealing pool with
+// |thread_count| workers (0: one per core) instead of the uv thread pool. Complete callbacks still run on the
+// loop thread of the env. Starting a running pool keeps its size.
+NAPI_EXTERN napi_status napi_start_async_work_pool(napi_env env, size_t thread_count);
+// Stop the pool once the works already queued have run, later works go to the uv thread pool again.
+NAPI_EXTERN napi_status napi_stop_async_work_pool(napi_env env);
+// |hits|: async works created in recycled storage, |misses|: async works that needed a fresh allocation.
+NAPI_EXTERN napi_status napi_get_async_work_cache_stats(napi_env env, uint64_t* hits, uint64_t* misses);
+// Same as napi_queue_async_work_with_qos, a work that has not started |timeout_ms| from now is dropped and
+// completes with napi_cancelled.
+NAPI_EXTERN napi_status napi_queue_async_work_with_deadline(napi_env env,
+                                                            napi_async_work work,
+                                                            napi_qos_t qos,
+                                                            uint64_t timeout_ms);
+// Cancellation token for the execute callback, may be polled from any thread. |result| turns true once the work
+// was cancelled by napi_cancel_async_work or its deadline passed.
+NAPI_EXTERN napi_status napi_is_async_work_cancelled(napi_env env, napi_async_work work, bool* result);
+// Run |execute| once for each of the |count| pointers in |data| in parallel, then call |complete| once on the loop
+// thread with |complete_data|. |data| is copied, the caller may free it when the call returns.
+NAPI_EXTERN napi_status napi_queue_async_work_batch(napi_env env,
+                                                    napi_value async_resource_name,
+                                                    napi_async_execute_callback execute,
+                                                    void* const* data,
+                                                    size_t count,
+                                                    napi_async_complete_callback complete,
+                                                    void* complete_data,
+                                                    napi_qos_t qos);
 
 typedef struct napi_strong_ref__* napi_strong_ref;
 typedef struct napi_critical_scope__* napi_critical_scope;
@@ -127,6 +154,59 @@ NAPI_EXTERN napi_status napi_call_threadsafe_function_with_priority(napi_threads
                                                                     void *data,
                                                                     napi_task_priority priority,
                                                                     bool isTail);
+// Batch variant of napi_threadsafe_function_call_js. |data| holds |count| items drained in one pass.
+typedef void (*napi_threadsafe_function_call_js_batch)(napi_env env,
+                                                       napi_value js_callback,
+                                                       void* context,
+                                                       void** data,
+                                                       size_t count);
+// Switch the threadsafe function to batch-drain mode: every wakeup of the loop thread hands all queued
+// items to |call_js_batch_cb| at once instead of calling call_js_cb per item. Must be called on the
+// thread of |env|.
+NAPI_EXTERN napi_status napi_set_threadsafe_function_batch_callback(
+    napi_env env, napi_threadsafe_function func, napi_threadsafe_function_call_js_batch call_js_batch_cb);
+
+typedef enum {
+    napi_tsfn_queue_default = 0,
+    // Bounded lock-free ring, producers only lock when they block on a full queue. Requires max_queue_size > 0.
+    napi_tsfn_queue_lock_free = 1,
+} napi_threadsafe_function_queue_type;
+// Same as napi_create_threadsafe_function, with |queue_type| selecting the storage of pending calls.
+NAPI_EXTERN napi_status napi_create_threadsafe_function_with_queue_type(napi_env env,
+                                                                        napi_value func,
+                                                                        napi_value async_resource,
+                                                                        napi_value async_resource_name,
+                                                                        size_t max_queue_size,
+                                                                        size_t initial_thread_count,
+                                                                        void* thread_finalize_data,
+                                                                        napi_finalize thread_finalize_cb,
+                                                                        void* context,
+                                                                        napi_threadsafe_function_call_js call_js_cb,
+                                                                        napi_threadsafe_function_queue_type queue_type,
+                                                                        napi_threadsafe_function* result);
+// Same as napi_create_threadsafe_function on the default queue, every call copies |payload_size| bytes
+// (1 to 64) into a slot preallocated at creation, so calls never allocate. call_js_cb receives a pointer to
+// the slot as |data|, it stays valid until call_js_cb returns. Requires max_queue_size > 0.
+NAPI_EXTERN napi_status napi_create_threadsafe_function_with_inline_payload(napi_env env,
+                                                                            napi_value func,
+                                                                            napi_value async_resource,
+                                                                            napi_value async_resource_name,
+                                                                            size_t max_queue_size,
+                                                                            size_t initial_thread_count,
+                                                                            void* thread_finalize_data,
+                                                                            napi_finalize thread_finalize_cb,
+                                                                            void* context,
+                                                                            napi_threadsafe_function_call_js call_js_cb,
+                                                                            size_t payload_size,
+                                                                            napi_threadsafe_function* result);
+// Copies payload_size bytes from |payload|, only valid for threadsafe functions with an inline payload.
+NAPI_EXTERN napi_status napi_call_threadsafe_function_with_payload(napi_threadsafe_function func,
+                                                                   const void* payload,
+                                                                   napi_threadsafe_function_call_mode is_blocking);
+// |sent|: posts that issued a loop wakeup, |elided|: posts that found a wakeup already pending.
+NAPI_EXTERN napi_status napi_get_threadsafe_function_wakeup_stats(napi_threadsafe_function func,
+                                                                  uint64_t* sent,
+                                                                  uint64_t* elided);
 NAPI_EXTERN napi_status napi_create_map(napi_env env, napi_value* result);
 NAPI_EXTERN napi_status napi_map_set_property(napi_env env, napi_value map, napi_value key, napi_value value);
 NAPI_EXTERN napi_status napi_map_set_named_property(napi_env env,
@@ -221,6 +301,31 @@ NAPI_EXTERN napi_status napi_queue_async_work_with_queue(napi_env env,
                                                          napi_qos_t qos,
                                                          uintptr_t taskId);
 
+typedef struct {
+    size_t active_queues; // queues with works waiting or running
+    size_t pending;       // works queued and not completed yet
+    uint64_t executed;
+    uint64_t rejected;    // works refused because the backlog of their queue was full
+} napi_async_work_queue_stats;
+// Counters of the ordered queues of napi_queue_async_work_with_queue on the loop of |env|.
+NAPI_EXTERN napi_status napi_get_async_work_queue_stats(napi_env env, napi_async_work_queue_stats* result);
+
+typedef struct {
+    size_t live_references;           // napi_ref and wrap references of |env|
+    size_t free_reference_slots;      // preallocated storage ready for new references
+    size_t live_sendable_references;
+    size_t reserved_bytes;            // storage held for both kinds, live or free
+} napi_reference_memory_stats;
+// Memory of the reference objects owned by |env|.
+NAPI_EXTERN napi_status napi_get_reference_memory_stats(napi_env env, napi_reference_memory_stats* result);
+// Bulk napi_create_reference / napi_delete_reference, all or nothing.
+NAPI_EXTERN napi_status napi_create_references(napi_env env,
+                                               size_t count,
+                                               const napi_value* values,
+                                               uint32_t initial_refcount,
+                                               napi_ref* results);
+NAPI_EXTERN napi_status napi_delete_references(napi_env env, size_t count, const napi_ref* refs);
+
 NAPI_EXTERN napi_status napi_create_strong_reference(napi_env env, napi_value value, napi_strong_ref* result);
 NAPI_EXTERN napi_status napi_delete_strong_reference(napi_env env, napi_strong_ref ref);
 NAPI_EXTERN napi_status napi_get_strong_reference_value(napi_env env, napi_strong_ref ref, napi_value* result);
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ark_async_finalizer_queue.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "native_engine/impl/ark/ark_native_engine.h"
+#include "utils/log.h"
+
+size_t ArkAsyncFinalizerQueue::Enqueue(uv_loop_t* loop, std::vector<RefAsyncFinalizer>& finalizers)
+{
+    size_t total = finalizers.size();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t begin = 0; begin < total; begin += BATCH_SIZE) {
+            size_t end = std::min(begin + BATCH_SIZE, total);
+            std::vector<RefAsyncFinalizer> batch = AcquireBuffer();
+            batch.assign(finalizers.begin() + begin, finalizers.begin() + end);
+            batches_.emplace_back(std::move(batch));
+        }
+    }
+    finalizers.clear();
+    size_t backlog = backlog_.fetch_add(total, std::memory_order_relaxed) + total;
+    stats_->asyncBacklog.store(backlog, std::memory_order_relaxed);
+    Schedule(loop);
+    return backlog;
+}
+
+bool ArkAsyncFinalizerQueue::RunBatch(bool onJSThread)
+{
+    std::vector<RefAsyncFinalizer> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (batches_.empty()) {
+            return false;
+        }
+        batch = std::move(batches_.front());
+        batches_.pop_front();
+    }
+    auto begin = std::chrono::steady_clock::now();
+    ArkNativeEngine::RunAsyncCallbacks(&batch);
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    size_t backlog = backlog_.fetch_sub(batch.size(), std::memory_order_relaxed) - batch.size();
+    stats_->RecordAsyncBatch(batch.size(), static_cast<uint64_t>(duration.count()), onJSThread, backlog);
+    std::lock_guard<std::mutex> lock(mutex_);
+    ReleaseBuffer(std::move(batch));
+    return true;
+}
+
+void ArkAsyncFinalizerQueue::Schedule(uv_loop_t* loop)
+{
+    size_t count = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // one work item per batch that no queued work item is going to take
+        while (inFlight_ + count < MAX_IN_FLIGHT && waiting_ + count < batches_.size()) {
+            count++;
+        }
+        inFlight_ += count;
+        waiting_ += count;
+    }
+    bool failed = false;
+    for (size_t i = 0; i < count; i++) {
+        if (!failed && QueueWork(loop)) {
+            continue;
+        }
+        failed = true;
+        std::lock_guard<std::mutex> lock(mutex_);
+        inFlight_--;
+        waiting_--;
+    }
+    if (failed) {
+        while (RunBatch(true)) {
+            // drained on the loop thread instead
+        }
+    }
+}
+
+bool ArkAsyncFinalizerQueue::QueueWork(uv_loop_t* loop)
+{
+    auto work = new Work();
+    work->work.data = reinterpret_cast<void *>(work);
+    work->queue = shared_from_this();
+    int ret = uv_queue_work_with_qos(loop, &work->work, [](uv_work_t *work) {
+        ArkAsyncFinalizerQueue* queue = reinterpret_cast<Work *>(work->data)->queue.get();
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex_);
+            queue->waiting_--;
+        }
+        // the JS thread may have taken the batch meanwhile
+        queue->RunBatch();
+    }, [](uv_work_t *work, int32_t status) {
+        auto done = reinterpret_cast<Work *>(work->data);
+        std::shared_ptr<ArkAsyncFinalizerQueue> queue = std::move(done->queue);
+        uv_loop_t* loop = work->loop;
+        delete done;
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex_);
+            queue->inFlight_--;
+            // a cancelled work item never took its batch
+            if (status != 0) {
+                queue->waiting_--;
+            }
+        }
+        queue->Schedule(loop);
+    }, uv_qos_t(napi_qos_background));
+    if (ret != 0) {
+        HILOG_ERROR("uv_queue_work fail ret '%{public}d'", ret);
+        delete work;
+        return false;
+    }
+    return true;
+}
+
+std::vector<RefAsyncFinalizer> ArkAsyncFinalizerQueue::AcquireBuffer()
+{
+    if (buffers_.empty()) {
+        std::vector<RefAsyncFinalizer> buffer;
+        buffer.reserve(BATCH_SIZE);
+        return buffer;
+    }
+    std::vector<RefAsyncFinalizer> buffer = std::move(buffers_.back());
+    buffers_.pop_back();
+    return buffer;
+}
+
+void ArkAsyncFinalizerQueue::ReleaseBuffer(std::vector<RefAsyncFinalizer>&& buffer)
+{
+    if (buffers_.size() >= MAX_CACHED_BUFFERS) {
+        return;
+    }
+    buffer.clear();
+    buffers_.emplace_back(std::move(buffer));
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_ASYNC_FINALIZER_QUEUE_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_ASYNC_FINALIZER_QUEUE_H
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "native_engine/impl/ark/ark_finalizers_pack.h"
+#include "uv.h"
+
+// Async finalizers of one engine on their way through the uv thread pool.
+// Finalizers are cut into batches of BATCH_SIZE, one work item carries one batch so a burst never occupies a pool
+// thread for long. Up to MAX_IN_FLIGHT work items are queued at once and run their batches in parallel, a finished
+// one is replaced from its after_work. Batch buffers are kept for the next GC. Enqueue and the scheduling run on the
+// loop thread, RunBatch on any thread.
+class ArkAsyncFinalizerQueue : public std::enable_shared_from_this<ArkAsyncFinalizerQueue> {
+public:
+    static constexpr size_t BATCH_SIZE = 1024;
+    static constexpr size_t MAX_CACHED_BUFFERS = 8;
+    // the default size of the uv thread pool
+    static constexpr size_t MAX_IN_FLIGHT = 4;
+
+    explicit ArkAsyncFinalizerQueue(std::shared_ptr<ArkFinalizersStats> stats) : stats_(std::move(stats)) {}
+    ~ArkAsyncFinalizerQueue() = default;
+
+    ArkAsyncFinalizerQueue(const ArkAsyncFinalizerQueue&) = delete;
+    ArkAsyncFinalizerQueue& operator=(const ArkAsyncFinalizerQueue&) = delete;
+
+    // Moves |finalizers| into batches for the pool of |loop|, it is left empty with its capacity.
+    // Returns the number of finalizers that have not run yet.
+    size_t Enqueue(uv_loop_t* loop, std::vector<RefAsyncFinalizer>& finalizers);
+    // Runs the oldest batch on the calling thread, false when there is none.
+    bool RunBatch(bool onJSThread = false);
+
+    size_t GetBacklog() const
+    {
+        return backlog_.load(std::memory_order_relaxed);
+    }
+    // Work items queued to the pool whose after_work has not run yet.
+    size_t GetInFlight()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return inFlight_;
+    }
+
+private:
+    struct Work {
+        uv_work_t work;
+        std::shared_ptr<ArkAsyncFinalizerQueue> queue;
+    };
+
+    void Schedule(uv_loop_t* loop);
+    bool QueueWork(uv_loop_t* loop);
+    std::vector<RefAsyncFinalizer> AcquireBuffer();
+    void ReleaseBuffer(std::vector<RefAsyncFinalizer>&& buffer);
+
+    std::shared_ptr<ArkFinalizersStats> stats_;
+    // guards batches_, buffers_, inFlight_ and waiting_
+    std::mutex mutex_;
+    std::deque<std::vector<RefAsyncFinalizer>> batches_;
+    std::vector<std::vector<RefAsyncFinalizer>> buffers_;
+    size_t inFlight_ {0};
+    // work items in flight that have not taken their batch yet
+    size_t waiting_ {0};
+    std::atomic<size_t> backlog_ {0};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_ASYNC_FINALIZER_QUEUE_H */
@@ -16,6 +16,11 @@
 #ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_FINALIZERS_PACK_H
 #define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_FINALIZERS_PACK_H
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+
 #include "ecmascript/napi/include/jsnapi_expo.h"
 
 #include "interfaces/inner_api/napi/native_node_api.h"
@@ -24,9 +29,81 @@ class NativeEngine;
 
 using RefFinalizer = std::pair<NapiNativeFinalize, std::tuple<NativeEngine*, void*, void*>>;
 using RefAsyncFinalizer = std::pair<NapiNativeFinalize, std::pair<void*, void*>>;
-using ArkFinalizersPackFinishNotify = std::function<void(size_t totalNativeBindingSize)>;
+using ArkFinalizersPackFinishNotify =
+    std::function<void(size_t totalNativeBindingSize, size_t numFinalizers, uint64_t durationUs)>;
 using ArkCrashHolder = panda::ArkCrashHolder;
 
+// Timing of finalizer packs run on the JS thread and of async finalizer batches and concurrent finalizer shards run
+// on background threads. Batches and shards may outlive their engine, so they share ownership of the stats.
+struct ArkFinalizersStats {
+    std::atomic<uint64_t> packs {0};
+    std::atomic<uint64_t> finalizers {0};
+    std::atomic<uint64_t> lastPackUs {0};
+    std::atomic<uint64_t> maxPackUs {0};
+    std::atomic<uint64_t> totalPackUs {0};
+    std::atomic<uint64_t> concurrentShards {0};
+    std::atomic<uint64_t> concurrentFinalizers {0};
+    std::atomic<uint64_t> maxShardUs {0};
+    std::atomic<uint64_t> slices {0};
+    std::atomic<uint64_t> idleSlices {0};
+    std::atomic<uint64_t> maxSliceUs {0};
+    std::atomic<uint64_t> syncDrains {0};
+    // finalizers waiting in packs that have not finished yet
+    std::atomic<uint64_t> backlog {0};
+    std::atomic<uint64_t> asyncBatches {0};
+    std::atomic<uint64_t> asyncFinalizers {0};
+    std::atomic<uint64_t> maxAsyncBatchUs {0};
+    // batches the JS thread ran itself because async finalization fell behind
+    std::atomic<uint64_t> asyncSyncBatches {0};
+    std::atomic<uint64_t> asyncBacklog {0};
+
+    void RecordPack(size_t count, uint64_t durationUs)
+    {
+        packs.fetch_add(1, std::memory_order_relaxed);
+        finalizers.fetch_add(count, std::memory_order_relaxed);
+        lastPackUs.store(durationUs, std::memory_order_relaxed);
+        totalPackUs.fetch_add(durationUs, std::memory_order_relaxed);
+        UpdateMax(maxPackUs, durationUs);
+    }
+
+    void RecordShard(size_t count, uint64_t durationUs)
+    {
+        concurrentShards.fetch_add(1, std::memory_order_relaxed);
+        concurrentFinalizers.fetch_add(count, std::memory_order_relaxed);
+        UpdateMax(maxShardUs, durationUs);
+    }
+
+    void RecordSlice(bool idle, uint64_t durationUs, size_t remaining)
+    {
+        slices.fetch_add(1, std::memory_order_relaxed);
+        if (idle) {
+            idleSlices.fetch_add(1, std::memory_order_relaxed);
+        }
+        UpdateMax(maxSliceUs, durationUs);
+        backlog.store(remaining, std::memory_order_relaxed);
+    }
+
+    void RecordAsyncBatch(size_t count, uint64_t durationUs, bool onJSThread, size_t remaining)
+    {
+        asyncBatches.fetch_add(1, std::memory_order_relaxed);
+        asyncFinalizers.fetch_add(count, std::memory_order_relaxed);
+        if (onJSThread) {
+            asyncSyncBatches.fetch_add(1, std::memory_order_relaxed);
+        }
+        UpdateMax(maxAsyncBatchUs, durationUs);
+        asyncBacklog.store(remaining, std::memory_order_relaxed);
+    }
+
+private:
+    static void UpdateMax(std::atomic<uint64_t>& target, uint64_t value)
+    {
+        uint64_t current = target.load(std::memory_order_relaxed);
+        while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            // a failed exchange reloads current
+        }
+    }
+};
+
 class ArkFinalizersPack {
 public:
     ArkFinalizersPack() = default;
@@ -39,6 +116,8 @@ public:
         finalizers_.clear();
         totalNativeBindingSize_ = 0;
         notify_ = nullptr;
+        cursor_ = 0;
+        processedUs_ = 0;
     }
     bool Empty() const
     {
@@ -52,16 +131,41 @@ public:
     {
         return finalizers_.size();
     }
-    void ProcessAll() const
+    size_t GetNumRemaining() const
     {
+        return finalizers_.size() - cursor_;
+    }
+    void ProcessAll()
+    {
+        ProcessSlice(GetNumRemaining(), std::numeric_limits<uint64_t>::max());
+    }
+    // Runs finalizers from where the last slice stopped, at most |maxCount| of them and no further once |budgetUs|
+    // is spent. The finish notify fires with the time of all slices together. Returns true when the pack is done.
+    bool ProcessSlice(size_t maxCount, uint64_t budgetUs)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        size_t end = cursor_ + std::min(maxCount, GetNumRemaining());
+        uint64_t elapsedUs = 0;
         INIT_CRASH_HOLDER(holder, "NAPI");
-        for (auto &iter : finalizers_) {
+        while (cursor_ < end) {
+            auto &iter = finalizers_[cursor_++];
             NapiNativeFinalize callback = iter.first;
             auto &[p0, p1, p2] = iter.second;
             holder.UpdateCallbackPtr(reinterpret_cast<uintptr_t>(callback));
             callback(reinterpret_cast<napi_env>(p0), p1, p2);
+            if ((cursor_ % SLICE_CLOCK_CHECK_INTERVAL) == 0 || cursor_ == end) {
+                elapsedUs = ElapsedUs(begin);
+                if (elapsedUs >= budgetUs) {
+                    break;
+                }
+            }
+        }
+        processedUs_ += elapsedUs;
+        if (cursor_ < finalizers_.size()) {
+            return false;
         }
-        NotifyFinish();
+        NotifyFinish(processedUs_);
+        return true;
     }
     size_t GetTotalNativeBindingSize() const
     {
@@ -73,15 +177,25 @@ public:
         totalNativeBindingSize_ += nativeBindingSize;
     }
 private:
-    void NotifyFinish() const
+    // reading the clock per finalizer would cost more than most finalizers
+    static constexpr size_t SLICE_CLOCK_CHECK_INTERVAL = 16;
+
+    static uint64_t ElapsedUs(std::chrono::steady_clock::time_point begin)
+    {
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+        return static_cast<uint64_t>(duration.count());
+    }
+    void NotifyFinish(uint64_t durationUs) const
     {
         if (notify_ != nullptr) {
-            notify_(totalNativeBindingSize_);
+            notify_(totalNativeBindingSize_, finalizers_.size(), durationUs);
         }
     }
     std::vector<RefFinalizer> finalizers_ {};
     size_t totalNativeBindingSize_ {0};
     ArkFinalizersPackFinishNotify notify_ {nullptr};
+    size_t cursor_ {0};
+    uint64_t processedUs_ {0};
 };
 
 #endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_FINALIZERS_PACK_H */
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ark_function_info_pool.h"
+
+#include <new>
+
+#include "utils/log.h"
+
+ArkFunctionInfoPool::~ArkFunctionInfoPool()
+{
+    for (Chunk* chunk : chunks_) {
+        delete chunk;
+    }
+}
+
+// Chunks are few, a full current chunk falls back to any chunk with a free slot before a new one.
+ArkFunctionInfoPool::Chunk* ArkFunctionInfoPool::FindChunk()
+{
+    if (current_ != nullptr && !current_->IsFull()) {
+        return current_;
+    }
+    for (Chunk* chunk : chunks_) {
+        if (!chunk->IsFull()) {
+            current_ = chunk;
+            return chunk;
+        }
+    }
+    Chunk* chunk = new (std::nothrow) Chunk();
+    if (chunk == nullptr) {
+        HILOG_ERROR("failed to allocate function info chunk");
+        return nullptr;
+    }
+    chunk->pool = this;
+    chunk->index = chunks_.size();
+    chunks_.push_back(chunk);
+    current_ = chunk;
+    return chunk;
+}
+
+NapiFunctionInfo* ArkFunctionInfoPool::Allocate()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Chunk* chunk = FindChunk();
+    if (chunk == nullptr) {
+        return nullptr;
+    }
+    Slot* slot = chunk->freeList;
+    if (slot != nullptr) {
+        chunk->freeList = slot->nextFree;
+    } else {
+        slot = &chunk->slots[chunk->used++];
+    }
+    slot->info = NapiFunctionInfo();
+    slot->chunk = chunk;
+    chunk->live++;
+    live_++;
+    return &slot->info;
+}
+
+void ArkFunctionInfoPool::Deleter([[maybe_unused]] void* env, [[maybe_unused]] void* externalPointer, void* data)
+{
+    if (data == nullptr) {
+        return;
+    }
+    auto slot = reinterpret_cast<Slot*>(data);
+    slot->chunk->pool->Free(slot);
+}
+
+void ArkFunctionInfoPool::RemoveChunk(Chunk* chunk)
+{
+    Chunk* last = chunks_.back();
+    chunks_[chunk->index] = last;
+    last->index = chunk->index;
+    chunks_.pop_back();
+    delete chunk;
+}
+
+void ArkFunctionInfoPool::Free(Slot* slot)
+{
+    bool last = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Chunk* chunk = slot->chunk;
+        slot->nextFree = chunk->freeList;
+        chunk->freeList = slot;
+        chunk->live--;
+        live_--;
+        if (chunk->live == 0 && chunk != current_) {
+            RemoveChunk(chunk);
+        }
+        last = released_ && live_ == 0;
+    }
+    if (last) {
+        delete this;
+    }
+}
+
+void ArkFunctionInfoPool::Release()
+{
+    bool empty = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        released_ = true;
+        empty = live_ == 0;
+    }
+    if (empty) {
+        delete this;
+    }
+}
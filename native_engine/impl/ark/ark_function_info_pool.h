@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_FUNCTION_INFO_POOL_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_FUNCTION_INFO_POOL_H
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "native_engine/native_value.h"
+
+// Arena of the NapiFunctionInfo of native functions and classes created in one engine.
+// Infos are carved from chunks of CHUNK_SLOTS and go back to the free list of their chunk when their function dies,
+// pass Deleter as the native pointer deleter instead of CommonDeleter, or call it for an info that never reached a
+// function. A chunk is freed once all its infos are back, except the one allocations are served from. Functions may
+// outlive the engine until the VM is destroyed, so the engine calls Release and the pool goes away with its last
+// info. Sendable functions may be collected by another thread and keep using heap infos.
+class ArkFunctionInfoPool {
+public:
+    static constexpr size_t CHUNK_SLOTS = 256;
+
+    ArkFunctionInfoPool() = default;
+
+    ArkFunctionInfoPool(const ArkFunctionInfoPool&) = delete;
+    ArkFunctionInfoPool& operator=(const ArkFunctionInfoPool&) = delete;
+
+    // A default initialized info, nullptr when out of memory.
+    NapiFunctionInfo* Allocate();
+    static void Deleter(void* env, void* externalPointer, void* data);
+    // Called once by the engine when it goes away, deletes the pool at once or with its last info.
+    void Release();
+
+    size_t GetLiveCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return live_;
+    }
+
+    size_t GetChunkCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return chunks_.size();
+    }
+
+private:
+    struct Chunk;
+
+    struct Slot {
+        // first member, Deleter gets back from the info to its slot
+        NapiFunctionInfo info;
+        union {
+            Chunk* chunk;
+            Slot* nextFree;
+        };
+    };
+
+    struct Chunk {
+        ArkFunctionInfoPool* pool {nullptr};
+        Slot* freeList {nullptr};
+        // slots not handed out yet
+        size_t used {0};
+        size_t live {0};
+        // position in chunks_
+        size_t index {0};
+        Slot slots[CHUNK_SLOTS];
+
+        bool IsFull() const
+        {
+            return freeList == nullptr && used == CHUNK_SLOTS;
+        }
+    };
+
+    ~ArkFunctionInfoPool();
+    Chunk* FindChunk();
+    void Free(Slot* slot);
+    void RemoveChunk(Chunk* chunk);
+
+    mutable std::mutex mutex_;
+    std::vector<Chunk*> chunks_;
+    // the chunk allocations are served from, kept even when empty
+    Chunk* current_ {nullptr};
+    size_t live_ {0};
+    bool released_ {false};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_FUNCTION_INFO_POOL_H */
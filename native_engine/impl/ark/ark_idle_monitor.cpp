@@ -97,15 +97,21 @@ private:
     std::string context_;
 };
 
-void ArkIdleMonitor::NotifyLooperIdleStart(int64_t timestamp, [[maybe_unused]] int idleTime)
+void ArkIdleMonitor::NotifyLooperIdleStart(int64_t timestamp, int idleTime)
 {
     SetIdleState(true);
     AddIdleNotifyCount();
     recordedRunningNotifyInterval_.Push(timestamp - idleEndTimestamp_);
 #ifndef DISABLE_SHORT_IDLE_CHECK
-    CheckShortIdleTask(timestamp, idleTime);
+    // the looper is also observed for finalizers when idle gc is disabled
+    if (gEnableIdleGC) {
+        CheckShortIdleTask(timestamp, idleTime);
+    }
 #endif
     SetNotifyTimestamp(timestamp);
+    if (mainEngine_ != nullptr) {
+        static_cast<ArkNativeEngine*>(mainEngine_)->RunFinalizersInIdle(idleTime);
+    }
 }
 
 void ArkIdleMonitor::CheckShortIdleTask(int64_t timestamp, int idleTime)
@@ -385,13 +391,18 @@ void ArkIdleMonitor::EnableIdleGC(NativeEngine *engine)
 {
 #if defined(ENABLE_EVENT_HANDLER)
     auto vm = const_cast<EcmaVM *>(engine->GetEcmaVm());
-    if (gEnableIdleGC && JSNApi::IsJSMainThreadOfEcmaVM(vm)) {
+    bool isMainThread = JSNApi::IsJSMainThreadOfEcmaVM(vm);
+    if (isMainThread) {
+        // looper idle periods run queued finalizer packs whether idle gc is enabled or not
+        SetMainThreadEngine(engine);
+        PostLooperTriggerIdleGCTask();
+    }
+    if (gEnableIdleGC && isMainThread) {
         SetMainThreadEcmaVM(vm);
         JSNApi::SetTriggerGCTaskCallback(vm, [engine](TriggerGCData& data) {
             engine->PostTriggerGCTask(data, nullptr);
         });
         SetStartTimerCallback();
-        PostLooperTriggerIdleGCTask();
         JSNApi::SetNotifyDeferFreezeCallback([this](bool isNeedFreeze) {
             NotifyNeedFreeze(isNeedFreeze);
         });
@@ -174,6 +174,11 @@ public:
         mainVM_ = vm;
     }
 
+    void SetMainThreadEngine(NativeEngine* engine)
+    {
+        mainEngine_ = engine;
+    }
+
     void RegisterSentTaskWorkerEnv(napi_env workerEnv)
     {
         std::lock_guard<std::mutex> lock(sentTaskMutex_);
@@ -307,6 +312,8 @@ private:
     static uint64_t GetIdleMonitoringInterval();
 
     EcmaVM* mainVM_ {nullptr};
+    // runs its queued finalizers when the looper goes idle
+    NativeEngine* mainEngine_ {nullptr};
 
     static constexpr uint32_t IDLE_CHECK_LENGTH = 15;
     static constexpr uint32_t IDLE_INBACKGROUND_CHECK_LENGTH = 4;
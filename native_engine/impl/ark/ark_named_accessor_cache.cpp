@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ark_named_accessor_cache.h"
+
+#include <atomic>
+
+#include "utils/log.h"
+
+using panda::JSNApi;
+using panda::Local;
+using panda::StringRef;
+
+bool ArkNamedAccessorCache::Get(const panda::EcmaVM* vm,
+                                napi_named_accessor* accessor,
+                                Local<StringRef>& key,
+                                uintptr_t& callsite)
+{
+    uint32_t id = GetId(accessor);
+    if (id > entries_.size()) {
+        entries_.resize(id);
+    }
+    Entry& entry = entries_[id - 1];
+    if (entry.callsite == 0) {
+        uintptr_t info = JSNApi::NapiCreateCallsiteInfo(vm);
+        if (info == 0) {
+            HILOG_ERROR("failed to create callsite info of accessor %{public}s", accessor->name);
+            return false;
+        }
+        entry.key = panda::Global<StringRef>(vm, StringRef::NewFromUtf8(vm, accessor->name));
+        entry.callsite = info;
+        size_++;
+    }
+    key = entry.key.ToLocal(vm);
+    callsite = entry.callsite;
+    return true;
+}
+
+void ArkNamedAccessorCache::Release(const panda::EcmaVM* vm)
+{
+    for (auto& entry : entries_) {
+        if (entry.callsite != 0) {
+            entry.key.FreeGlobalHandleAddr();
+            JSNApi::NapiDeleteCallsiteInfo(vm, entry.callsite);
+        }
+    }
+    entries_.clear();
+    size_ = 0;
+}
+
+uint32_t ArkNamedAccessorCache::GetId(napi_named_accessor* accessor)
+{
+    // accessors are static and shared by the engines of all threads
+    uint32_t id = __atomic_load_n(&accessor->id, __ATOMIC_ACQUIRE);
+    if (id != 0) {
+        return id;
+    }
+    static std::atomic<uint32_t> nextId {1};
+    uint32_t newId = nextId.fetch_add(1, std::memory_order_relaxed);
+    // a concurrent first use may have won, its id is kept and newId stays unused
+    if (__atomic_compare_exchange_n(&accessor->id, &id, newId, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return newId;
+    }
+    return id;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_NAMED_ACCESSOR_CACHE_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_NAMED_ACCESSOR_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ecmascript/napi/include/jsnapi.h"
+#include "interfaces/inner_api/napi/native_node_api.h"
+
+// Property keys and callsite infos of the napi_named_accessor objects used in one engine.
+// Accessors get a process-wide id on first use in any engine, the entry of an id in an engine is created the first
+// time the accessor is used there: its key string, held by a global handle, and a callsite info of the VM. Entries
+// stay until Release, so every access with one accessor passes the same key and inline cache. JS thread only.
+class ArkNamedAccessorCache {
+public:
+    ArkNamedAccessorCache() = default;
+    ~ArkNamedAccessorCache() = default;
+
+    ArkNamedAccessorCache(const ArkNamedAccessorCache&) = delete;
+    ArkNamedAccessorCache& operator=(const ArkNamedAccessorCache&) = delete;
+
+    // Returns false when the callsite info could not be created.
+    bool Get(const panda::EcmaVM* vm,
+             napi_named_accessor* accessor,
+             panda::Local<panda::StringRef>& key,
+             uintptr_t& callsite);
+    size_t Size() const
+    {
+        return size_;
+    }
+    // Frees every key and callsite info, before the VM goes away.
+    void Release(const panda::EcmaVM* vm);
+
+private:
+    struct Entry {
+        panda::Global<panda::StringRef> key;
+        uintptr_t callsite {0};
+    };
+
+    static uint32_t GetId(napi_named_accessor* accessor);
+
+    // indexed by id - 1
+    std::vector<Entry> entries_;
+    size_t size_ {0};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_NAMED_ACCESSOR_CACHE_H */
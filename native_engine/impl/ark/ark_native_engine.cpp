@@ -15,6 +15,7 @@
 
 #include "ark_native_engine.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdint>
 
@@ -190,9 +191,9 @@ void FunctionSetContainerId(napi_env env, panda::Local<panda::JSValueRef> &value
 static Local<panda::JSValueRef> NapiNativeCreateFunction(napi_env env, const char* name,
                                                          NapiNativeCallback cb, void* value)
 {
-    auto engine = reinterpret_cast<NativeEngine*>(env);
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
     auto vm = const_cast<EcmaVM*>(engine->GetEcmaVm());
-    NapiFunctionInfo* funcInfo = NapiFunctionInfo::CreateNewInstance();
+    NapiFunctionInfo* funcInfo = engine->GetFunctionInfoPool()->Allocate();
     if (funcInfo == nullptr) {
         HILOG_ERROR("funcInfo is nullptr");
         return JSValueRef::Undefined(vm);
@@ -208,7 +209,7 @@ static Local<panda::JSValueRef> NapiNativeCreateFunction(napi_env env, const cha
 
     Local<JSValueRef> context = engine->GetContext();
     Local<panda::FunctionRef> fn = panda::FunctionRef::NewConcurrentWithName(vm, context, ArkNativeFunctionCallBack,
-                                                                             CommonDeleter, name,
+                                                                             ArkFunctionInfoPool::Deleter, name,
                                                                              reinterpret_cast<void*>(funcInfo), true);
     return fn;
 }
@@ -295,14 +296,14 @@ static Local<panda::FunctionRef> NapiCreateClassFunction(napi_env env, std::stri
     Local<panda::FunctionRef> fn;
     if (propCount == 0) {
         fn = panda::FunctionRef::NewConcurrentClassFunctionWithName(vm, context, ArkNativeFunctionCallBack,
-                                                                    CommonDeleter, className.c_str(),
+                                                                    ArkFunctionInfoPool::Deleter, className.c_str(),
                                                                     reinterpret_cast<void*>(funcInfo), true);
     } else if (propCount <= panda::ObjectRef::MAX_PROPERTIES_ON_STACK) {
         Local<panda::JSValueRef> keys[panda::ObjectRef::MAX_PROPERTIES_ON_STACK];
         PropertyAttribute attrs[panda::ObjectRef::MAX_PROPERTIES_ON_STACK];
         size_t staticPropCount = NapiGetKeysAndAttrsFromProps(env, propCount, properties, &keys[0], &attrs[0]);
         fn = panda::FunctionRef::NewConcurrentClassFunctionWithName(vm, context, ArkNativeFunctionCallBack,
-                                                                    CommonDeleter, className.c_str(),
+                                                                    ArkFunctionInfoPool::Deleter, className.c_str(),
                                                                     reinterpret_cast<void*>(funcInfo), true, propCount,
                                                                     staticPropCount, &keys[0], &attrs[0]);
     } else {
@@ -312,11 +313,13 @@ static Local<panda::FunctionRef> NapiCreateClassFunction(napi_env env, std::stri
         if (attrs != nullptr && keys != nullptr) {
             size_t staticPropCount = NapiGetKeysAndAttrsFromProps(env, propCount, properties, keys, attrs);
             fn = panda::FunctionRef::NewConcurrentClassFunctionWithName(vm, context, ArkNativeFunctionCallBack,
-                                                                        CommonDeleter, className.c_str(),
+                                                                        ArkFunctionInfoPool::Deleter, className.c_str(),
                                                                         reinterpret_cast<void*>(funcInfo), true,
                                                                         propCount, staticPropCount, keys, attrs);
         } else {
             fn = panda::JSValueRef::Undefined(vm);
+            // no function owns the info, hand it back
+            ArkFunctionInfoPool::Deleter(env, nullptr, funcInfo);
             napi_throw_error(env, nullptr, "malloc failed in napi_define_class");
         }
 
@@ -339,7 +342,7 @@ panda::Local<panda::JSValueRef> NapiDefineClass(napi_env env, const char* name,
         className = ArkNativeEngine::tempModuleName_ + "." + name;
     }
 
-    NapiFunctionInfo* funcInfo = NapiFunctionInfo::CreateNewInstance();
+    NapiFunctionInfo* funcInfo = reinterpret_cast<ArkNativeEngine*>(env)->GetFunctionInfoPool()->Allocate();
     if (funcInfo == nullptr) {
         HILOG_ERROR("funcInfo is nullptr");
         return panda::JSValueRef::Undefined(vm);
@@ -622,6 +625,8 @@ ArkNativeEngine::~ArkNativeEngine()
                isMainEnvContext_ ? "" : "ArkContextEngine", GetId());
 
     engineState_ = ArkNativeEngineState::RELEASING;
+    // before Deinit, which closes the loop
+    ReleaseFinalizersBacklog();
 
     if (isMainEnvContext_) {
         // unregister worker env for idle GC
@@ -633,6 +638,7 @@ ArkNativeEngine::~ArkNativeEngine()
         Deinit();
         if (JSNApi::IsJSMainThreadOfEcmaVM(vm_)) {
             ArkIdleMonitor::GetInstance()->SetMainThreadEcmaVM(nullptr);
+            ArkIdleMonitor::GetInstance()->SetMainThreadEngine(nullptr);
         }
     } else {
         DeconstructCtxEnv();
@@ -641,6 +647,10 @@ ArkNativeEngine::~ArkNativeEngine()
     for (auto&& [module, exportObj] : loadedModules_) {
         exportObj.FreeGlobalHandleAddr();
     }
+    handleTable_.Release();
+    namedAccessorCache_.Release(vm_);
+    // infos of functions still alive go back to the pool when the VM frees them
+    functionInfoPool_->Release();
     // Free callbackRef
     if (promiseRejectCallbackRef_ != nullptr) {
         delete promiseRejectCallbackRef_;
@@ -1593,7 +1603,7 @@ panda::Local<panda::ObjectRef> ArkNativeEngine::LoadModuleByName(const std::stri
             Local<ObjectRef> object = ObjectRef::NewWrappedNapiObject(vm_);
             NativeReference* ref = nullptr;
             Local<JSValueRef> value(instanceValue);
-            ref = new ArkNativeReference(this, value, 0, true, nullptr, instance, nullptr);
+            ref = new (GetReferenceManager()) ArkNativeReference(this, value, 0, true, nullptr, instance, nullptr);
 
             object->SetNativePointerFieldCount(vm_, 1);
             object->SetNativePointerField(vm_, 0, ref, nullptr, nullptr, 0);
@@ -2063,20 +2073,45 @@ napi_value ArkNativeEngine::CreateInstance(napi_value constructor, napi_value co
 NativeReference* ArkNativeEngine::CreateReference(napi_value value, uint32_t initialRefcount,
     bool flag, NapiNativeFinalize callback, void* data, void* hint, size_t nativeBindingSize)
 {
-    return new ArkNativeReference(this, value, initialRefcount, flag, callback, data, hint, false, nativeBindingSize);
+    return new (GetReferenceManager())
+        ArkNativeReference(this, value, initialRefcount, flag, callback, data, hint, false, nativeBindingSize);
 }
 
 NativeReference* ArkNativeEngine::CreateXRefReference(napi_value value, uint32_t initialRefcount,
     bool flag, NapiNativeFinalize callback, void* data)
 {
     ArkNativeReferenceConfig config(initialRefcount, flag, callback, data);
-    return new ArkXRefNativeReference(this, value, config);
+    return new (GetReferenceManager()) ArkXRefNativeReference(this, value, config);
 }
 
 NativeReference* ArkNativeEngine::CreateAsyncReference(napi_value value, uint32_t initialRefcount,
-    bool flag, NapiNativeFinalize callback, void* data, void* hint)
+    bool flag, NapiNativeFinalize callback, void* data, void* hint, size_t nativeBindingSize)
+{
+    return new (GetReferenceManager())
+        ArkNativeReference(this, value, initialRefcount, flag, callback, data, hint, true, nativeBindingSize);
+}
+
+NativeReference* ArkNativeEngine::CreateConcurrentReference(napi_value value, uint32_t initialRefcount,
+    bool flag, NapiNativeFinalize callback, void* data, void* hint, size_t nativeBindingSize)
 {
-    return new ArkNativeReference(this, value, initialRefcount, flag, callback, data, hint, true);
+    auto ref = new (GetReferenceManager())
+        ArkNativeReference(this, value, initialRefcount, flag, callback, data, hint, true, nativeBindingSize);
+    if (ref != nullptr) {
+        ref->SetConcurrentFinalizer();
+    }
+    return ref;
+}
+
+size_t ArkNativeEngine::CreateReferences(const napi_value* values, size_t count, uint32_t initialRefcount,
+    NativeReference** results)
+{
+    std::vector<void*> blocks(count, nullptr);
+    size_t allocated = NativeReferenceManager::AllocateReferences(GetReferenceManager(), sizeof(ArkNativeReference),
+                                                                  blocks.data(), count);
+    for (size_t i = 0; i < allocated; i++) {
+        results[i] = ::new (blocks[i]) ArkNativeReference(this, values[i], initialRefcount);
+    }
+    return allocated;
 }
 
 __attribute__((optnone)) void ArkNativeEngine::RunCallbacks(TriggerGCData *triggerGCData)
@@ -2120,74 +2155,214 @@ __attribute__((optnone)) void ArkNativeEngine::RunAsyncCallbacks(std::vector<Ref
 #endif
 }
 
+__attribute__((optnone)) void ArkNativeEngine::RunConcurrentCallbacks(std::vector<RefAsyncFinalizer> *finalizers,
+                                                                       ArkFinalizersStats *stats)
+{
+    auto begin = std::chrono::steady_clock::now();
+    RunAsyncCallbacks(finalizers);
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    stats->RecordShard(finalizers->size(), static_cast<uint64_t>(duration.count()));
+}
+
+struct ArkConcurrentFinalizersShard {
+    uv_work_t work;
+    std::vector<RefAsyncFinalizer> finalizers;
+    std::shared_ptr<ArkFinalizersStats> stats;
+};
+
+// Concurrent finalizers have no order among each other, they are split into contiguous shards that run on the
+// uv thread pool in parallel.
+void ArkNativeEngine::PostConcurrentFinalizeTasks()
+{
+    std::vector<RefAsyncFinalizer> finalizers;
+    finalizers.swap(pendingConcurrentFinalizers_);
+    size_t total = finalizers.size();
+    size_t shardCount = (total + MIN_CONCURRENT_FINALIZER_SHARD_SIZE - 1) / MIN_CONCURRENT_FINALIZER_SHARD_SIZE;
+    shardCount = std::min(shardCount, MAX_CONCURRENT_FINALIZER_SHARDS);
+    size_t begin = 0;
+    for (size_t i = 0; i < shardCount; i++) {
+        size_t end = begin + (total - begin) / (shardCount - i);
+        auto shard = new ArkConcurrentFinalizersShard();
+        shard->work.data = reinterpret_cast<void *>(shard);
+        shard->finalizers.assign(finalizers.begin() + begin, finalizers.begin() + end);
+        shard->stats = finalizersStats_;
+        begin = end;
+
+        int ret = uv_queue_work_with_qos(GetUVLoop(), &shard->work, [](uv_work_t *work) {
+            auto shard = reinterpret_cast<ArkConcurrentFinalizersShard *>(work->data);
+            RunConcurrentCallbacks(&shard->finalizers, shard->stats.get());
+        }, [](uv_work_t *work, int32_t) {
+            delete reinterpret_cast<ArkConcurrentFinalizersShard *>(work->data);
+        }, uv_qos_t(napi_qos_background));
+        if (ret != 0) {
+            HILOG_ERROR("uv_queue_work fail ret '%{public}d'", ret);
+            RunConcurrentCallbacks(&shard->finalizers, shard->stats.get());
+            delete shard;
+        }
+    }
+}
+
 void ArkNativeEngine::PostFinalizeTasks()
 {
     if (IsInDestructor()) {
         return;
     }
+    memoryAccounting_.NotifyGC();
+    if (memoryAccounting_.GetBindingObjects() > 0 || memoryAccounting_.GetExternalBytes() > 0) {
+        memoryAccounting_.LogSnapshotIfDue(NATIVE_MEMORY_SNAPSHOT_INTERVAL_MS, NATIVE_MEMORY_SNAPSHOT_TAGS);
+    }
     if (!pendingAsyncFinalizers_.empty()) {
-        uv_work_t *asynWork = new uv_work_t;
-        std::vector<RefAsyncFinalizer> *asyncFinalizers = new std::vector<RefAsyncFinalizer>();
-        asyncFinalizers->swap(pendingAsyncFinalizers_);
-        asynWork->data = reinterpret_cast<void *>(asyncFinalizers);
-
-        int ret = uv_queue_work_with_qos(GetUVLoop(), asynWork, [](uv_work_t *asynWork) {
-            std::vector<RefAsyncFinalizer> *finalizers =
-                reinterpret_cast<std::vector<RefAsyncFinalizer> *>(asynWork->data);
-            RunAsyncCallbacks(finalizers);
-            HILOG_DEBUG("uv_queue_work async running ");
-            delete finalizers;
-        }, [](uv_work_t *asynWork, int32_t) {
-            delete asynWork;
-        }, uv_qos_t(napi_qos_background));
-        if (ret != 0) {
-            HILOG_ERROR("uv_queue_work fail ret '%{public}d'", ret);
-            RunAsyncCallbacks(asyncFinalizers);
-            delete asynWork;
-            delete asyncFinalizers;
+        size_t backlog = asyncFinalizerQueue_->Enqueue(GetUVLoop(), pendingAsyncFinalizers_);
+        // finalization fell behind allocation, the JS thread helps until the backlog is back under the limit
+        while (backlog > MAX_ASYNC_FINALIZERS_BACKLOG && asyncFinalizerQueue_->RunBatch(true)) {
+            backlog = asyncFinalizerQueue_->GetBacklog();
         }
     }
+    if (!pendingConcurrentFinalizers_.empty()) {
+        PostConcurrentFinalizeTasks();
+    }
     if (arkFinalizersPack_.Empty()) {
         return;
     }
     ArkFinalizersPack *finalizersPack = new ArkFinalizersPack();
     std::swap(arkFinalizersPack_, *finalizersPack);
+    std::shared_ptr<ArkFinalizersStats> stats = finalizersStats_;
     if (!IsMainThread()) {
+        finalizersPack->RegisterFinishNotify([stats] (size_t, size_t numFinalizers, uint64_t durationUs) {
+            stats->RecordPack(numFinalizers, durationUs);
+        });
         panda::JsiNativeScope nativeScope(vm_);
         RunCallbacks(finalizersPack);
         delete finalizersPack;
         return;
     }
     size_t bindingSize = finalizersPack->GetTotalNativeBindingSize();
-    if (pendingFinalizersPackNativeBindingSize_ > FINALIZERS_PACK_PENDING_NATIVE_BINDING_SIZE_THRESHOLD &&
-        bindingSize > 0) {
-        HILOG_DEBUG("Pending Finalizers NativeBindingSize '%{public}zu' large than '%{public}zu', process sync.",
-            pendingFinalizersPackNativeBindingSize_, FINALIZERS_PACK_PENDING_NATIVE_BINDING_SIZE_THRESHOLD);
-        panda::JsiNativeScope nativeScope(vm_);
-        RunCallbacks(finalizersPack);
-        delete finalizersPack;
-        return;
-    }
-    uv_work_t *syncWork = new uv_work_t;
-    finalizersPack->RegisterFinishNotify([this] (size_t totalNativeBindingSize) {
+    bool underPressure = bindingSize > 0 &&
+        pendingFinalizersPackNativeBindingSize_ > FINALIZERS_PACK_PENDING_NATIVE_BINDING_SIZE_THRESHOLD;
+    finalizersPack->RegisterFinishNotify([this, stats] (size_t totalNativeBindingSize, size_t numFinalizers,
+                                                       uint64_t durationUs) {
         this->DecreasePendingFinalizersPackNativeBindingSize(totalNativeBindingSize);
+        stats->RecordPack(numFinalizers, durationUs);
     });
     IncreasePendingFinalizersPackNativeBindingSize(bindingSize);
+    finalizersBacklogCount_ += finalizersPack->GetNumFinalizers();
+    finalizersBacklog_.emplace_back(finalizersPack);
+    if (underPressure || finalizersBacklogCount_ > MAX_FINALIZERS_BACKLOG) {
+        HILOG_DEBUG("Pending Finalizers NativeBindingSize '%{public}zu', backlog '%{public}zu', process sync.",
+            pendingFinalizersPackNativeBindingSize_, finalizersBacklogCount_);
+        panda::JsiNativeScope nativeScope(vm_);
+        DrainFinalizersBacklog();
+        return;
+    }
+    ScheduleFinalizersSlice();
+}
 
-    syncWork->data = reinterpret_cast<void *>(finalizersPack);
-    int ret = uv_queue_work_with_qos(GetUVLoop(), syncWork, [](uv_work_t *) {}, [](uv_work_t *syncWork, int32_t) {
-        ArkFinalizersPack *finalizersPack = reinterpret_cast<ArkFinalizersPack*>(syncWork->data);
-        RunCallbacks(finalizersPack);
-        delete syncWork;
-        delete finalizersPack;
-    }, uv_qos_t(napi_qos_background));
+bool ArkNativeEngine::RunFinalizersSlice(size_t maxCount, uint64_t budgetUs, bool idle)
+{
+#ifdef ENABLE_HITRACE
+    StartTrace(HITRACE_TAG_ACE, "RunFinalizeSlice:" + std::to_string(finalizersBacklogCount_));
+#endif
+    auto begin = std::chrono::steady_clock::now();
+    uint64_t elapsedUs = 0;
+    size_t count = 0;
+    while (!finalizersBacklog_.empty() && count < maxCount && elapsedUs < budgetUs) {
+        // owned here while it runs, a finalizer may trigger a GC that drains the rest of the backlog
+        std::unique_ptr<ArkFinalizersPack> finalizersPack = std::move(finalizersBacklog_.front());
+        finalizersBacklog_.pop_front();
+        size_t remaining = finalizersPack->GetNumRemaining();
+        bool finished = finalizersPack->ProcessSlice(maxCount - count, budgetUs - elapsedUs);
+        size_t processed = remaining - finalizersPack->GetNumRemaining();
+        count += processed;
+        finalizersBacklogCount_ -= processed;
+        if (!finished) {
+            finalizersBacklog_.emplace_front(std::move(finalizersPack));
+        }
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+        elapsedUs = static_cast<uint64_t>(duration.count());
+    }
+    finalizersStats_->RecordSlice(idle, elapsedUs, finalizersBacklogCount_);
+#ifdef ENABLE_HITRACE
+    FinishTrace(HITRACE_TAG_ACE);
+#endif
+    return finalizersBacklog_.empty();
+}
+
+// Yields to the loop between slices, the idle handle runs the next slice in the following loop iteration after the
+// events that arrived meanwhile, and the loop polls without blocking until the backlog is empty.
+void ArkNativeEngine::ScheduleFinalizersSlice()
+{
+    if (finalizersSliceScheduled_ || finalizersBacklog_.empty()) {
+        return;
+    }
+    if (engineState_ == ArkNativeEngineState::RELEASING) {
+        // finalizers run by ReleaseFinalizersBacklog may queue more packs, nothing is left for the loop
+        panda::JsiNativeScope nativeScope(vm_);
+        DrainFinalizersBacklog();
+        return;
+    }
+    if (finalizersSliceIdle_ == nullptr) {
+        uv_idle_t *sliceIdle = new uv_idle_t;
+        int ret = uv_idle_init(GetUVLoop(), sliceIdle);
+        if (ret != 0) {
+            HILOG_ERROR("uv_idle_init fail ret '%{public}d'", ret);
+            delete sliceIdle;
+            panda::JsiNativeScope nativeScope(vm_);
+            DrainFinalizersBacklog();
+            return;
+        }
+        sliceIdle->data = reinterpret_cast<void *>(this);
+        finalizersSliceIdle_ = sliceIdle;
+    }
+    int ret = uv_idle_start(finalizersSliceIdle_, [](uv_idle_t *sliceIdle) {
+        ArkNativeEngine *engine = reinterpret_cast<ArkNativeEngine *>(sliceIdle->data);
+        if (engine->RunFinalizersSlice(FINALIZERS_SLICE_MAX_COUNT, FINALIZERS_SLICE_BUDGET_US, false)) {
+            uv_idle_stop(sliceIdle);
+            engine->finalizersSliceScheduled_ = false;
+        }
+    });
     if (ret != 0) {
-        HILOG_ERROR("uv_queue_work fail ret '%{public}d'", ret);
+        HILOG_ERROR("uv_idle_start fail ret '%{public}d'", ret);
         panda::JsiNativeScope nativeScope(vm_);
-        RunCallbacks(finalizersPack);
-        delete syncWork;
-        delete finalizersPack;
+        DrainFinalizersBacklog();
+        return;
+    }
+    finalizersSliceScheduled_ = true;
+}
+
+void ArkNativeEngine::DrainFinalizersBacklog()
+{
+    finalizersStats_->syncDrains.fetch_add(1, std::memory_order_relaxed);
+    RunFinalizersSlice(std::numeric_limits<size_t>::max(), std::numeric_limits<uint64_t>::max(), false);
+}
+
+// The packs still waiting for a slice run before the env goes away, the idle handle is freed once the loop has
+// closed it.
+void ArkNativeEngine::ReleaseFinalizersBacklog()
+{
+    if (!finalizersBacklog_.empty()) {
+        panda::JsiNativeScope nativeScope(vm_);
+        DrainFinalizersBacklog();
+    }
+    finalizersSliceScheduled_ = false;
+    if (finalizersSliceIdle_ == nullptr) {
+        return;
     }
+    uv_idle_stop(finalizersSliceIdle_);
+    finalizersSliceIdle_->data = nullptr;
+    uv_close(reinterpret_cast<uv_handle_t *>(finalizersSliceIdle_), [](uv_handle_t *handle) {
+        delete reinterpret_cast<uv_idle_t *>(handle);
+    });
+    finalizersSliceIdle_ = nullptr;
+}
+
+void ArkNativeEngine::RunFinalizersInIdle(int idleTimeMs)
+{
+    if (finalizersBacklog_.empty() || idleTimeMs <= 0) {
+        return;
+    }
+    uint64_t budgetUs = std::min(static_cast<uint64_t>(idleTimeMs) * 1000 / 2, // 1000: us per ms, 2: half
+                                 MAX_IDLE_FINALIZERS_SLICE_BUDGET_US);
+    RunFinalizersSlice(std::numeric_limits<size_t>::max(), budgetUs, true);
 }
 
 __attribute__((optnone)) void ArkNativeEngine::RunCallbacks(AsyncNativeCallbacksPack *callbacksPack)
@@ -2489,6 +2664,14 @@ void ArkNativeEngine::TriggerFatalException(panda::Local<panda::JSValueRef> exce
 
 bool ArkNativeEngine::AdjustExternalMemory(int64_t ChangeInBytes, int64_t* AdjustedValue)
 {
+    ArkNativeEngine* rootEngine = IsMainEnvContext() ? this : const_cast<ArkNativeEngine*>(GetParent());
+    NativeMemoryAccounting& accounting = rootEngine->GetMemoryAccounting();
+    *AdjustedValue = accounting.AdjustExternal(ChangeInBytes);
+    if (ChangeInBytes > 0 && accounting.ShouldRequestGC(EXTERNAL_MEMORY_GC_STEP)) {
+        HILOG_DEBUG("external memory grew to %{public}" PRId64 ", request gc", *AdjustedValue);
+        TriggerGCData data(reinterpret_cast<void*>(vm_), static_cast<uint8_t>(JSNApi::TRIGGER_IDLE_GC_TYPE::FULL_GC));
+        rootEngine->PostTriggerGCTask(data);
+    }
     return true;
 }
 
@@ -3572,7 +3755,7 @@ void ArkNativeEngine::RegisterAllPromiseCallback(NapiAllPromiseRejectCallback ca
     panda::LocalScope scope(vm_);
     auto cb = reinterpret_cast<NapiNativeCallback>(
         NapiErrorManager::GetInstance()->GetGlobalUnhandledRejectionCheckCallback());
-    NapiFunctionInfo* funcInfo = NapiFunctionInfo::CreateNewInstance();
+    NapiFunctionInfo* funcInfo = functionInfoPool_->Allocate();
     if (funcInfo == nullptr) {
         HILOG_ERROR("funcInfo is nullptr");
         return;
@@ -3583,10 +3766,10 @@ void ArkNativeEngine::RegisterAllPromiseCallback(NapiAllPromiseRejectCallback ca
 
     Local<JSValueRef> context = GetContext();
     Local<panda::FunctionRef> fn = panda::FunctionRef::NewConcurrent(vm_, context, ArkNativeFunctionCallBack,
-        CommonDeleter, reinterpret_cast<void*>(funcInfo), true);
+        ArkFunctionInfoPool::Deleter, reinterpret_cast<void*>(funcInfo), true);
     Local<panda::StringRef> fnName = panda::StringRef::NewFromUtf8(vm_, checkCallbackName.c_str());
     fn->SetName(vm_, fnName);
-    globalCheckCallbackRef_ = new ArkNativeReference(this, JsValueFromLocalValue(fn), 1);
+    globalCheckCallbackRef_ = new (GetReferenceManager()) ArkNativeReference(this, JsValueFromLocalValue(fn), 1);
 }
 
 void ArkNativeEngine::SetTaskpoolShrinkCallback(TaskPoolShrinkCallback callback)
@@ -21,6 +21,7 @@
 #include <sys/wait.h>
 #include <sys/types.h>
 #endif
+#include <deque>
 #include <iostream>
 #include <map>
 #include <mutex>
@@ -28,12 +29,18 @@
 #include <thread>
 #include <unistd.h>
 
+#include "ark_async_finalizer_queue.h"
+#include "ark_function_info_pool.h"
 #include "ark_idle_monitor.h"
+#include "ark_named_accessor_cache.h"
+#include "ark_native_handle_table.h"
 #include "ark_native_options.h"
 #include "ecmascript/napi/include/dfx_jsnapi.h"
 #include "ecmascript/napi/include/jsnapi.h"
 #include "native_engine/impl/ark/ark_finalizers_pack.h"
 #include "native_engine/native_engine.h"
+#include "native_engine/native_memory_accounting.h"
+#include "native_engine/native_reference_leak_tracker.h"
 
 namespace panda::ecmascript {
 struct JsHeapDumpWork;
@@ -227,7 +234,14 @@ public:
     NativeReference* CreateXRefReference(napi_value value, uint32_t initialRefcount, bool flag = false,
         NapiNativeFinalize callback = nullptr, void* data = nullptr);
     NativeReference* CreateAsyncReference(napi_value value, uint32_t initialRefcount, bool flag = false,
-        NapiNativeFinalize callback = nullptr, void* data = nullptr, void* hint = nullptr) override;
+        NapiNativeFinalize callback = nullptr, void* data = nullptr, void* hint = nullptr,
+        size_t nativeBindingSize = 0) override;
+    NativeReference* CreateConcurrentReference(napi_value value, uint32_t initialRefcount, bool flag = false,
+        NapiNativeFinalize callback = nullptr, void* data = nullptr, void* hint = nullptr,
+        size_t nativeBindingSize = 0) override;
+    // User owned references to |count| values with storage taken at once, returns how many were created.
+    size_t CreateReferences(const napi_value* values, size_t count, uint32_t initialRefcount,
+        NativeReference** results);
     napi_value CreatePromise(NativeDeferred** deferred) override;
     void* CreateRuntime(bool isLimitedWorker = false) override;
     panda::Local<panda::ObjectRef> LoadArkModule(const void *buffer, int32_t len, const std::string& fileName);
@@ -342,6 +356,9 @@ public:
     void NotifyNativeCalling(const void *nativeAddress);
 
     void PostFinalizeTasks();
+    void PostConcurrentFinalizeTasks();
+    // Runs queued finalizer packs for a part of |idleTimeMs|, called at the start of a looper idle period.
+    void RunFinalizersInIdle(int idleTimeMs);
     void PostAsyncTask(panda::AsyncNativeCallbacksPack *callbacksPack);
     void PostTriggerGCTask(panda::TriggerGCData& data, GCTaskFinishedCallback callback = nullptr) override;
 
@@ -355,6 +372,41 @@ public:
         return pendingAsyncFinalizers_;
     }
 
+    std::vector<RefAsyncFinalizer> &GetPendingConcurrentFinalizers()
+    {
+        return pendingConcurrentFinalizers_;
+    }
+
+    const ArkFinalizersStats &GetFinalizersStats() const
+    {
+        return *finalizersStats_;
+    }
+
+    NativeMemoryAccounting &GetMemoryAccounting()
+    {
+        return memoryAccounting_;
+    }
+
+    ArkNativeHandleTable &GetHandleTable()
+    {
+        return handleTable_;
+    }
+
+    ArkNamedAccessorCache &GetNamedAccessorCache()
+    {
+        return namedAccessorCache_;
+    }
+
+    ArkFunctionInfoPool *GetFunctionInfoPool() const
+    {
+        return functionInfoPool_;
+    }
+
+    NativeReferenceLeakTracker &GetReferenceLeakTracker()
+    {
+        return referenceLeakTracker_;
+    }
+
     void RegisterNapiUncaughtExceptionHandler(NapiUncaughtExceptionCallback callback) override;
     void HandleUncaughtException() override;
     bool HasPendingException() override;
@@ -431,6 +483,20 @@ public:
         panda::Local<panda::ObjectRef>& exportCopy, const std::string& apiPath);
 
     static constexpr size_t FINALIZERS_PACK_PENDING_NATIVE_BINDING_SIZE_THRESHOLD = 500 * 1024 * 1024;  // 500 MB
+    static constexpr size_t MAX_CONCURRENT_FINALIZER_SHARDS = 4;
+    static constexpr size_t MIN_CONCURRENT_FINALIZER_SHARD_SIZE = 64;
+    // a finalizers slice posted to the loop, idle slices get up to half of the reported idle time
+    static constexpr size_t FINALIZERS_SLICE_MAX_COUNT = 256;
+    static constexpr uint64_t FINALIZERS_SLICE_BUDGET_US = 1000;
+    static constexpr uint64_t MAX_IDLE_FINALIZERS_SLICE_BUDGET_US = 10000;
+    // beyond this many waiting finalizers the backlog is drained at once
+    static constexpr size_t MAX_FINALIZERS_BACKLOG = 100000;
+    // beyond this many async finalizers not yet run the JS thread runs batches itself after a GC
+    static constexpr size_t MAX_ASYNC_FINALIZERS_BACKLOG = 64 * ArkAsyncFinalizerQueue::BATCH_SIZE;
+    // external memory growth that requests a GC, the VM already sees native binding sizes itself
+    static constexpr size_t EXTERNAL_MEMORY_GC_STEP = 64 * 1024 * 1024; // 64 MB
+    static constexpr uint64_t NATIVE_MEMORY_SNAPSHOT_INTERVAL_MS = 60 * 1000;
+    static constexpr size_t NATIVE_MEMORY_SNAPSHOT_TAGS = 5;
 
     bool IsContainerScopeEnabled() const override
     {
@@ -511,6 +577,7 @@ private:
 
     static void RunCallbacks(ArkFinalizersPack *finalizersPack);
     static void RunAsyncCallbacks(std::vector<RefAsyncFinalizer> *finalizers);
+    static void RunConcurrentCallbacks(std::vector<RefAsyncFinalizer> *finalizers, ArkFinalizersStats *stats);
     static void RunCallbacks(panda::AsyncNativeCallbacksPack *callbacks);
     static void RunCallbacks(panda::TriggerGCData *triggerGCData);
     static void SetAttribute(bool isLimitedWorker, panda::RuntimeOption &option);
@@ -526,6 +593,11 @@ private:
     {
         pendingFinalizersPackNativeBindingSize_ -= nativeBindingSize;
     }
+    // Returns true when the backlog is empty afterwards.
+    bool RunFinalizersSlice(size_t maxCount, uint64_t budgetUs, bool idle);
+    void ScheduleFinalizersSlice();
+    void DrainFinalizersBacklog();
+    void ReleaseFinalizersBacklog();
 
     bool IsLimitWorker() const override
     {
@@ -561,7 +633,29 @@ private:
     bool isLimitedWorker_ = false;
     size_t pendingFinalizersPackNativeBindingSize_ {0};
     ArkFinalizersPack arkFinalizersPack_ {};
+    // packs run slice by slice on the JS thread, between loop iterations or in idle periods
+    std::deque<std::unique_ptr<ArkFinalizersPack>> finalizersBacklog_ {};
+    size_t finalizersBacklogCount_ {0};
+    bool finalizersSliceScheduled_ {false};
+    // runs a slice per loop iteration while started, freed by its close callback
+    uv_idle_t* finalizersSliceIdle_ {nullptr};
     std::vector<RefAsyncFinalizer> pendingAsyncFinalizers_ {};
+    // finalizers that may run in parallel, split into shards over the uv thread pool
+    std::vector<RefAsyncFinalizer> pendingConcurrentFinalizers_ {};
+    std::shared_ptr<ArkFinalizersStats> finalizersStats_ { std::make_shared<ArkFinalizersStats>() };
+    // batches of pendingAsyncFinalizers_ on the uv thread pool
+    std::shared_ptr<ArkAsyncFinalizerQueue> asyncFinalizerQueue_ {
+        std::make_shared<ArkAsyncFinalizerQueue>(finalizersStats_) };
+    // native memory pinned by the objects of this engine and its contexts
+    NativeMemoryAccounting memoryAccounting_;
+    // allocation sites of sampled references of this engine and its contexts
+    NativeReferenceLeakTracker referenceLeakTracker_;
+    // strong references of napi_create_strong_handle, released with the engine
+    ArkNativeHandleTable handleTable_;
+    // keys and callsite infos of napi_named_accessor objects, released with the engine
+    ArkNamedAccessorCache namedAccessorCache_;
+    // infos of the native functions and classes of this engine, released in the destructor
+    ArkFunctionInfoPool* functionInfoPool_ { new ArkFunctionInfoPool() };
     // napi options and its cache
     NapiOptions* options_ { nullptr };
     // Initialize the default value to false rather than isolating it with macros.
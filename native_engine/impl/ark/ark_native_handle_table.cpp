@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ark_native_handle_table.h"
+
+#include "utils/log.h"
+
+using panda::ArrayRef;
+using panda::JSValueRef;
+using panda::Local;
+
+uint32_t ArkNativeHandleTable::Create(const panda::EcmaVM* vm, Local<JSValueRef> value)
+{
+    uint32_t slot = 0;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        if (inUse_.size() >= MAX_SLOTS) {
+            HILOG_ERROR("handle table is full");
+            return INVALID_ID;
+        }
+        slot = static_cast<uint32_t>(inUse_.size());
+        if ((slot & (CHUNK_SIZE - 1)) == 0) {
+            Local<ArrayRef> chunk = ArrayRef::New(vm, CHUNK_SIZE);
+            chunks_.emplace_back(vm, chunk);
+        }
+        inUse_.emplace_back(false);
+        generations_.emplace_back(0);
+    }
+    ArrayRef::SetValueAt(vm, ChunkOf(slot), slot & (CHUNK_SIZE - 1), value);
+    inUse_[slot] = true;
+    size_++;
+    return MakeId(slot, generations_[slot]);
+}
+
+Local<JSValueRef> ArkNativeHandleTable::Get(const panda::EcmaVM* vm, uint32_t id) const
+{
+    uint32_t slot = SlotOf(id);
+    if (slot == MAX_SLOTS) {
+        return Local<JSValueRef>();
+    }
+    return ArrayRef::GetValueAt(vm, ChunkOf(slot), slot & (CHUNK_SIZE - 1));
+}
+
+bool ArkNativeHandleTable::Set(const panda::EcmaVM* vm, uint32_t id, Local<JSValueRef> value)
+{
+    uint32_t slot = SlotOf(id);
+    if (slot == MAX_SLOTS) {
+        return false;
+    }
+    return ArrayRef::SetValueAt(vm, ChunkOf(slot), slot & (CHUNK_SIZE - 1), value);
+}
+
+bool ArkNativeHandleTable::Delete(const panda::EcmaVM* vm, uint32_t id)
+{
+    uint32_t slot = SlotOf(id);
+    if (slot == MAX_SLOTS) {
+        return false;
+    }
+    // the value may be collected from now on
+    ArrayRef::SetValueAt(vm, ChunkOf(slot), slot & (CHUNK_SIZE - 1), JSValueRef::Undefined(vm));
+    inUse_[slot] = false;
+    // wraps around, a stale id is caught unless its slot was reused 256 times since
+    generations_[slot]++;
+    freeSlots_.emplace_back(slot);
+    size_--;
+    return true;
+}
+
+void ArkNativeHandleTable::Release()
+{
+    for (auto& chunk : chunks_) {
+        chunk.FreeGlobalHandleAddr();
+    }
+    chunks_.clear();
+    inUse_.clear();
+    generations_.clear();
+    freeSlots_.clear();
+    size_ = 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_NATIVE_HANDLE_TABLE_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_NATIVE_HANDLE_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ecmascript/napi/include/jsnapi.h"
+
+// Strong references of one engine named by 32-bit ids.
+// Values live in JS arrays of CHUNK_SIZE elements, each chunk held by one global handle, so a reference costs an
+// array element instead of a global handle and a NativeReference. The chunks are read through their global handles,
+// a Get only creates the local handle of its result. The low SLOT_BITS of an id are its slot plus one (chunk <<
+// CHUNK_SHIFT | index), the high bits the generation of the slot, bumped when the slot is freed, so an id deleted
+// once stays invalid after its slot is reused. 0 is never valid. Create, Get, Set and Delete are O(1), freed slots
+// are reused first. JS thread only.
+class ArkNativeHandleTable {
+public:
+    static constexpr uint32_t INVALID_ID = 0;
+
+    ArkNativeHandleTable() = default;
+    ~ArkNativeHandleTable() = default;
+
+    ArkNativeHandleTable(const ArkNativeHandleTable&) = delete;
+    ArkNativeHandleTable& operator=(const ArkNativeHandleTable&) = delete;
+
+    // Returns INVALID_ID when the table is full.
+    uint32_t Create(const panda::EcmaVM* vm, panda::Local<panda::JSValueRef> value);
+    // Empty when |id| is not in use.
+    panda::Local<panda::JSValueRef> Get(const panda::EcmaVM* vm, uint32_t id) const;
+    bool Set(const panda::EcmaVM* vm, uint32_t id, panda::Local<panda::JSValueRef> value);
+    bool Delete(const panda::EcmaVM* vm, uint32_t id);
+    size_t Size() const
+    {
+        return size_;
+    }
+    // Frees every slot at once, before the VM goes away.
+    void Release();
+
+private:
+    static constexpr uint32_t CHUNK_SHIFT = 10;
+    static constexpr uint32_t CHUNK_SIZE = 1u << CHUNK_SHIFT;
+    static constexpr uint32_t SLOT_BITS = 24;
+    static constexpr uint32_t SLOT_MASK = (1u << SLOT_BITS) - 1;
+    static constexpr uint32_t MAX_SLOTS = SLOT_MASK;
+
+    static uint32_t MakeId(uint32_t slot, uint8_t generation)
+    {
+        return (static_cast<uint32_t>(generation) << SLOT_BITS) | (slot + 1);
+    }
+    // The slot of |id|, or MAX_SLOTS when |id| is not in use.
+    uint32_t SlotOf(uint32_t id) const
+    {
+        uint32_t slot = (id & SLOT_MASK) - 1;
+        if (slot >= inUse_.size() || !inUse_[slot] || generations_[slot] != (id >> SLOT_BITS)) {
+            return MAX_SLOTS;
+        }
+        return slot;
+    }
+    panda::Local<panda::ArrayRef> ChunkOf(uint32_t slot) const
+    {
+        // aliases the global handle, no local handle is created
+        return chunks_[slot >> CHUNK_SHIFT].ToLocal();
+    }
+
+    std::vector<panda::Global<panda::ArrayRef>> chunks_;
+    std::vector<bool> inUse_;
+    std::vector<uint8_t> generations_;
+    std::vector<uint32_t> freeSlots_;
+    size_t size_ {0};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_NATIVE_HANDLE_TABLE_H */
@@ -16,6 +16,7 @@
 #include <cinttypes>
 
 #include "ark_native_reference.h"
+#include "ark_native_weak_table.h"
 
 #include "ecmascript/napi/include/jsnapi_expo.h"
 #include "native_engine/native_api_internal.h"
@@ -65,6 +66,21 @@ ArkNativeReference::ArkNativeReference(ArkNativeEngine* engine,
     ArkNativeReferenceConstructor();
 }
 
+void* ArkNativeReference::operator new(size_t size, NativeReferenceManager* manager) noexcept
+{
+    return NativeReferenceManager::AllocateReference(manager, size);
+}
+
+void ArkNativeReference::operator delete(void* ptr, [[maybe_unused]] NativeReferenceManager* manager) noexcept
+{
+    NativeReferenceSlab::Free(ptr);
+}
+
+void ArkNativeReference::operator delete(void* ptr) noexcept
+{
+    NativeReferenceSlab::Free(ptr);
+}
+
 void ArkNativeReference::ArkNativeReferenceConstructor()
 {
     if (napiCallback_ != nullptr) {
@@ -92,6 +108,27 @@ void ArkNativeReference::ArkNativeReferenceConstructor()
     }
 
     engineId_ = engine_->GetId();
+
+    if (nativeBindingSize_ > 0) {
+        // ResetFinalizer may clear napiCallback_ before finalization, keep the tag it was accounted under
+        bindingTag_ = reinterpret_cast<uintptr_t>(napiCallback_);
+        GetRootEngine()->GetMemoryAccounting().AddBinding(bindingTag_, nativeBindingSize_);
+    }
+
+    NativeReferenceLeakTracker& leakTracker = GetRootEngine()->GetReferenceLeakTracker();
+    if (leakTracker.ShouldSample()) {
+        std::string jsStack;
+        if (leakTracker.IsCapturingJsStack()) {
+            engine_->BuildJsStackTrace(jsStack);
+        }
+        leakTracker.Record(this, std::move(jsStack));
+        properties_ |= ReferencePropertiesMask::SAMPLED_MASK;
+    }
+}
+
+ArkNativeEngine* ArkNativeReference::GetRootEngine() const
+{
+    return engine_->IsMainEnvContext() ? engine_ : const_cast<ArkNativeEngine*>(engine_->GetParent());
 }
 
 uintptr_t ArkNativeReference::GetGlobalRefSlotAddress() const
@@ -117,6 +154,9 @@ ArkNativeReference::~ArkNativeReference()
 {
     VALID_ENGINE_CHECK(engine_, engine_, engineId_);
 
+    if ((properties_ & ReferencePropertiesMask::SAMPLED_MASK) != 0) {
+        GetRootEngine()->GetReferenceLeakTracker().Forget(this);
+    }
     if (!napiCallback_) {
         engine_->DecreaseNonCallbackRefCounter();
     }
@@ -124,8 +164,6 @@ ArkNativeReference::~ArkNativeReference()
     NativeReferenceManager* refMgr = engine_->GetReferenceManager();
     if (ownership_ == ReferenceOwnerShip::RUNTIME && refMgr != nullptr) {
         refMgr->ReleaseHandler(this);
-        prev_ = nullptr;
-        next_ = nullptr;
     }
     if (value_.IsEmpty()) {
         return;
@@ -216,12 +254,11 @@ void ArkNativeReference::EnqueueAsyncTask()
     std::pair<void*, void*> pair = std::make_pair(data_, hint_);
     RefAsyncFinalizer asyncFinalizer = std::make_pair(napiCallback_, pair);
     // Async callback doesn't require the current engine. Use the root engine if a context is passed.
-    if (engine_->IsMainEnvContext()) {
-        engine_->GetPendingAsyncFinalizers().emplace_back(asyncFinalizer);
+    ArkNativeEngine* rootEngine = GetRootEngine();
+    if (IsConcurrentFinalizer()) {
+        rootEngine->GetPendingConcurrentFinalizers().emplace_back(asyncFinalizer);
     } else {
-        const_cast<ArkNativeEngine*>(engine_->GetParent())
-            ->GetPendingAsyncFinalizers()
-            .emplace_back(asyncFinalizer);
+        rootEngine->GetPendingAsyncFinalizers().emplace_back(asyncFinalizer);
     }
 }
 
@@ -253,6 +290,12 @@ void ArkNativeReference::DispatchFinalizeCallback()
 
 void ArkNativeReference::FinalizeCallback(FinalizerState state)
 {
+    if (!GetFinalRun() && nativeBindingSize_ > 0) {
+        GetRootEngine()->GetMemoryAccounting().RemoveBinding(bindingTag_, nativeBindingSize_);
+    }
+    if (!GetFinalRun() && IsWeakTableEntry() && state == FinalizerState::COLLECTION && !engine_->IsInDestructor()) {
+        reinterpret_cast<ArkNativeWeakTable*>(hint_)->OnEntryCollected(this, data_);
+    }
     // Invoke the callback only if it is callbackble and has not already been invoked.
     if (!GetFinalRun() && napiCallback_ && !engine_->IsInDestructor()) {
         if (state == FinalizerState::COLLECTION) {
@@ -325,6 +368,26 @@ bool ArkNativeReference::IsAsyncCall() const
     return (properties_ & ReferencePropertiesMask::IS_ASYNC_CALL_MASK) != 0;
 }
 
+void ArkNativeReference::SetConcurrentFinalizer()
+{
+    properties_ |= ReferencePropertiesMask::CONCURRENT_FINALIZER_MASK;
+}
+
+bool ArkNativeReference::IsConcurrentFinalizer() const
+{
+    return (properties_ & ReferencePropertiesMask::CONCURRENT_FINALIZER_MASK) != 0;
+}
+
+void ArkNativeReference::SetWeakTableEntry()
+{
+    properties_ |= ReferencePropertiesMask::WEAK_TABLE_ENTRY_MASK;
+}
+
+bool ArkNativeReference::IsWeakTableEntry() const
+{
+    return (properties_ & ReferencePropertiesMask::WEAK_TABLE_ENTRY_MASK) != 0;
+}
+
 inline bool ArkNativeReference::HasDelete() const
 {
     return (properties_ & ReferencePropertiesMask::HAS_DELETE_MASK) != 0;
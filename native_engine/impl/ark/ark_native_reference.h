@@ -78,6 +78,11 @@ public:
                        size_t nativeBindingSize = 0);
     ~ArkNativeReference() override;
 
+    // Storage comes from the reference slab of |manager|, create with new (engine->GetReferenceManager()).
+    static void* operator new(size_t size, NativeReferenceManager* manager) noexcept;
+    static void operator delete(void* ptr, NativeReferenceManager* manager) noexcept;
+    static void operator delete(void* ptr) noexcept;
+
     uint32_t Ref() override;
     uint32_t Unref() override;
     napi_value Get() override;
@@ -90,6 +95,10 @@ public:
     bool GetFinalRun() override;
     napi_value GetNapiValue() override;
     void ResetFinalizer()  override;
+    // Async finalizer that may run concurrently with other finalizers, see napi_wrap_concurrent_finalizer.
+    void SetConcurrentFinalizer();
+    // Weak entry of the ArkNativeWeakTable in |hint|, keyed by |data|, the table learns of its collection.
+    void SetWeakTableEntry();
     uintptr_t GetGlobalRefSlotAddress() const override;
     NativeEngine* GetEngine() const
     {
@@ -120,6 +129,10 @@ protected:
         IS_ASYNC_CALL_MASK = DELETE_SELF_MASK << 1,
         HAS_DELETE_MASK = IS_ASYNC_CALL_MASK << 1,
         FINAL_RAN_MASK = HAS_DELETE_MASK << 1,
+        CONCURRENT_FINALIZER_MASK = FINAL_RAN_MASK << 1,
+        WEAK_TABLE_ENTRY_MASK = CONCURRENT_FINALIZER_MASK << 1,
+        // recorded by the reference leak tracker of the root engine
+        SAMPLED_MASK = WEAK_TABLE_ENTRY_MASK << 1,
     };
 
     void InitProperties(bool deleteSelf = false, bool isAsyncCall = false);
@@ -129,6 +142,8 @@ protected:
 
     Global<JSValueRef> value_;
     uint32_t refCount_ {0};
+    // slot in the registry of NativeReferenceManager, runtime owned references only
+    uint32_t registryIndex_ {NativeReferenceRegistry::INVALID_INDEX};
 
     const ReferenceOwnerShip ownership_;
     // Bit-packed flags: saves memory and speeds up object creation vs. multiple bools.
@@ -139,11 +154,13 @@ protected:
     void* data_ {nullptr};
     void* hint_ {nullptr};
     size_t nativeBindingSize_ {0};
-
-    NativeReference* prev_ {nullptr};
-    NativeReference* next_ {nullptr};
+    uintptr_t bindingTag_ {0};
 
     bool IsAsyncCall() const;
+    bool IsConcurrentFinalizer() const;
+    bool IsWeakTableEntry() const;
+    // contexts share the finalizer queues and the memory accounting of their root engine
+    ArkNativeEngine* GetRootEngine() const;
     bool HasDelete() const;
     void SetHasDelete();
     void SetFinalRan();
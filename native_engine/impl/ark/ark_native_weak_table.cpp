@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ark_native_weak_table.h"
+
+#include "ark_native_engine.h"
+#include "ark_native_reference.h"
+
+ArkNativeWeakTable::ArkNativeWeakTable(ArkNativeEngine* engine, napi_weak_table_callback callback, void* data)
+    : engine_(engine), callback_(callback), data_(data)
+{}
+
+ArkNativeWeakTable::~ArkNativeWeakTable()
+{
+    ReleaseCollected();
+}
+
+void ArkNativeWeakTable::Set(void* key, napi_value value)
+{
+    auto reference = new (engine_->GetReferenceManager()) ArkNativeReference(engine_, value, 0, false, nullptr, key,
+                                                                             this);
+    reference->SetWeakTableEntry();
+    auto [iter, inserted] = entries_.try_emplace(key, reference);
+    if (!inserted) {
+        delete iter->second;
+        iter->second = reference;
+    }
+}
+
+napi_value ArkNativeWeakTable::Get(void* key) const
+{
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+        return nullptr;
+    }
+    return iter->second->Get(engine_);
+}
+
+bool ArkNativeWeakTable::Delete(void* key)
+{
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+        return false;
+    }
+    delete iter->second;
+    entries_.erase(iter);
+    return true;
+}
+
+void ArkNativeWeakTable::OnEntryCollected(ArkNativeReference* reference, void* key)
+{
+    auto iter = entries_.find(key);
+    if (iter != entries_.end() && iter->second == reference) {
+        entries_.erase(iter);
+    }
+    collectedKeys_.emplace_back(key);
+    collectedReferences_.emplace_back(reference);
+    if (notifyPending_) {
+        return;
+    }
+    notifyPending_ = true;
+    // one finalizer per table and GC, it reports every key collected until it runs
+    ArkNativeEngine* root = engine_->IsMainEnvContext() ? engine_ : const_cast<ArkNativeEngine*>(engine_->GetParent());
+    std::tuple<NativeEngine*, void*, void*> tuple = std::make_tuple(engine_, this, nullptr);
+    RefFinalizer finalizer = std::make_pair(NotifyCollected, tuple);
+    root->GetArkFinalizersPack().AddFinalizer(finalizer, 0);
+}
+
+void ArkNativeWeakTable::NotifyCollected(napi_env env, void* data, [[maybe_unused]] void* hint)
+{
+    auto table = reinterpret_cast<ArkNativeWeakTable*>(data);
+    table->notifyPending_ = false;
+    if (table->destroyed_) {
+        delete table;
+        return;
+    }
+    std::vector<void*> keys;
+    keys.swap(table->collectedKeys_);
+    table->ReleaseCollected();
+    if (table->callback_ != nullptr) {
+        // the callback may set, delete or destroy the table
+        table->callback_(env, reinterpret_cast<napi_weak_table>(table), keys.data(), keys.size(), table->data_);
+    }
+}
+
+void ArkNativeWeakTable::ReleaseCollected()
+{
+    for (ArkNativeReference* reference : collectedReferences_) {
+        delete reference;
+    }
+    collectedReferences_.clear();
+}
+
+void ArkNativeWeakTable::Destroy(ArkNativeWeakTable* table)
+{
+    for (auto& [key, reference] : table->entries_) {
+        delete reference;
+    }
+    table->entries_.clear();
+    if (table->notifyPending_) {
+        table->destroyed_ = true;
+        return;
+    }
+    delete table;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_NATIVE_WEAK_TABLE_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_NATIVE_WEAK_TABLE_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "interfaces/inner_api/napi/native_node_api.h"
+
+class ArkNativeEngine;
+class ArkNativeReference;
+
+// Native keys mapped to weak references of JS values.
+// Entries are weak ArkNativeReference objects flagged as table entries. When the GC collects a value its entry
+// leaves the table at once and its key is queued; the first death of a GC puts one finalizer for the whole table
+// into the finalizers pack, which hands all queued keys to the callback in one call. JS thread only.
+class ArkNativeWeakTable {
+public:
+    ArkNativeWeakTable(ArkNativeEngine* engine, napi_weak_table_callback callback, void* data);
+
+    ArkNativeWeakTable(const ArkNativeWeakTable&) = delete;
+    ArkNativeWeakTable& operator=(const ArkNativeWeakTable&) = delete;
+
+    // Replaces the entry of |key| if there is one.
+    void Set(void* key, napi_value value);
+    // nullptr when |key| has no entry or its value is being collected.
+    napi_value Get(void* key) const;
+    // Returns false when |key| has no entry.
+    bool Delete(void* key);
+    size_t Size() const
+    {
+        return entries_.size();
+    }
+
+    // Called by the entry reference of |key| when the GC collected its value.
+    void OnEntryCollected(ArkNativeReference* reference, void* key);
+
+    // Deletes the table, or leaves that to the pending notification. Its callback is not called anymore.
+    static void Destroy(ArkNativeWeakTable* table);
+
+private:
+    ~ArkNativeWeakTable();
+    static void NotifyCollected(napi_env env, void* data, void* hint);
+    void ReleaseCollected();
+
+    ArkNativeEngine* engine_;
+    napi_weak_table_callback callback_;
+    void* data_;
+    std::unordered_map<void*, ArkNativeReference*> entries_;
+    // collected since the last notification, the references only wait to be freed
+    std::vector<void*> collectedKeys_;
+    std::vector<ArkNativeReference*> collectedReferences_;
+    bool notifyPending_ {false};
+    bool destroyed_ {false};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_ARK_NATIVE_WEAK_TABLE_H */
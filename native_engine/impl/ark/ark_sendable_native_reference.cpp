@@ -21,6 +21,21 @@ ArkSendableNativeReference::ArkSendableNativeReference(ArkNativeEngine* engine,
     : value_(engine->GetEcmaVm(), value)
 {}
 
+void* ArkSendableNativeReference::operator new(size_t size, NativeReferenceManager* manager) noexcept
+{
+    return NativeReferenceManager::AllocateSendableReference(manager, size);
+}
+
+void ArkSendableNativeReference::operator delete(void* ptr, [[maybe_unused]] NativeReferenceManager* manager) noexcept
+{
+    NativeReferenceSlab::Free(ptr);
+}
+
+void ArkSendableNativeReference::operator delete(void* ptr) noexcept
+{
+    NativeReferenceSlab::Free(ptr);
+}
+
 void ArkSendableNativeReference::DeleteSendableRef(ArkNativeEngine* engine)
 {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -28,6 +28,12 @@ class ArkSendableNativeReference {
 public:
     ArkSendableNativeReference(ArkNativeEngine* engine, panda::Local<JSValueRef> value);
     ~ArkSendableNativeReference() = default;
+
+    // Storage comes from the sendable reference slab of |manager|.
+    static void* operator new(size_t size, NativeReferenceManager* manager) noexcept;
+    static void operator delete(void* ptr, NativeReferenceManager* manager) noexcept;
+    static void operator delete(void* ptr) noexcept;
+
     void DeleteSendableRef(ArkNativeEngine* engine);
     napi_value Get(ArkNativeEngine* engine);
 private:
@@ -16,13 +16,17 @@
 #define NAPI_EXPERIMENTAL
 #endif
 
+#include <cstdarg>
+
 #include "ecmascript/napi/include/jsnapi.h"
 #include "ecmascript/napi/include/jsnapi_expo.h"
 #include "native_api_internal.h"
 #include "native_engine/impl/ark/ark_native_reference.h"
+#include "native_engine/impl/ark/ark_native_weak_table.h"
 #include "native_engine/impl/ark/ark_sendable_native_reference.h"
 #include "native_engine/native_create_env.h"
 #include "native_engine/native_utils.h"
+#include "native_engine/native_work_stealing_pool.h"
 #include "native_engine/worker_manager.h"
 #include "securec.h"
 
@@ -516,7 +520,7 @@ NAPI_EXTERN napi_status napi_create_function(napi_env env,
     EscapeLocalScope scope(vm);
     auto callback = reinterpret_cast<NapiNativeCallback>(cb);
     const char* name = "defaultName";
-    NapiFunctionInfo* funcInfo = NapiFunctionInfo::CreateNewInstance();
+    NapiFunctionInfo* funcInfo = reinterpret_cast<ArkNativeEngine*>(env)->GetFunctionInfoPool()->Allocate();
     if (funcInfo == nullptr) {
         HILOG_ERROR("funcInfo is nullptr");
         return napi_set_last_error(env, napi_invalid_arg);
@@ -532,7 +536,7 @@ NAPI_EXTERN napi_status napi_create_function(napi_env env,
 
     Local<JSValueRef> context = engine->GetContext();
     Local<panda::FunctionRef> fn = panda::FunctionRef::NewConcurrent(vm, context, ArkNativeFunctionCallBack,
-        CommonDeleter, reinterpret_cast<void*>(funcInfo), true);
+        ArkFunctionInfoPool::Deleter, reinterpret_cast<void*>(funcInfo), true);
     Local<panda::StringRef> fnName = panda::StringRef::NewFromUtf8(vm, utf8name != nullptr ? utf8name : name);
     fn->SetName(vm, fnName);
     *result = JsValueFromLocalValue(scope.Escape(fn));
@@ -1124,6 +1128,169 @@ NAPI_EXTERN napi_status napi_set_property_with_callsite_info(napi_env env, napi_
     return GET_RETURN_STATUS(env);
 }
 
+NAPI_EXTERN napi_status napi_get_named_property_cached(napi_env env,
+                                                      napi_value object,
+                                                      napi_named_accessor* accessor,
+                                                      napi_value* result)
+{
+    NAPI_PREAMBLE(env);
+    CHECK_ARG(env, object);
+    CHECK_ARG(env, accessor);
+    CHECK_ARG(env, accessor->name);
+    CHECK_ARG(env, result);
+
+    SWITCH_CONTEXT(env);
+    auto vm = engine->GetEcmaVm();
+    Local<panda::StringRef> key;
+    uintptr_t callsite = 0;
+    bool cached = reinterpret_cast<ArkNativeEngine*>(env)->GetNamedAccessorCache().Get(vm, accessor, key, callsite);
+    RETURN_STATUS_IF_FALSE(env, cached, napi_generic_failure);
+    panda::JsiFastNativeScope fastNativeScope(vm);
+    Local<panda::JSValueRef> value = JSNApi::NapiGetPropertyWithCallsiteInfo(
+        vm, reinterpret_cast<uintptr_t>(object),
+        reinterpret_cast<uintptr_t>(JsValueFromLocalValue(key)),
+        callsite,
+        nullptr);
+    RETURN_STATUS_IF_FALSE(env, NapiStatusValidationCheck(value), napi_object_expected);
+#ifdef ENABLE_CONTAINER_SCOPE
+    FunctionSetContainerId(env, value);
+#endif
+    *result = JsValueFromLocalValue(value);
+
+    return GET_RETURN_STATUS(env);
+}
+
+NAPI_EXTERN napi_status napi_set_named_property_cached(napi_env env,
+                                                      napi_value object,
+                                                      napi_named_accessor* accessor,
+                                                      napi_value value)
+{
+    NAPI_PREAMBLE(env);
+    CHECK_ARG(env, object);
+    CHECK_ARG(env, accessor);
+    CHECK_ARG(env, accessor->name);
+    CHECK_ARG(env, value);
+
+    SWITCH_CONTEXT(env);
+    auto vm = engine->GetEcmaVm();
+    Local<panda::StringRef> key;
+    uintptr_t callsite = 0;
+    bool cached = reinterpret_cast<ArkNativeEngine*>(env)->GetNamedAccessorCache().Get(vm, accessor, key, callsite);
+    RETURN_STATUS_IF_FALSE(env, cached, napi_generic_failure);
+    panda::JsiFastNativeScope fastNativeScope(vm);
+    auto nativeValue = LocalValueFromJsValue(object);
+    CHECK_AND_CONVERT_TO_OBJECT(env, vm, nativeValue, obj);
+    (void)obj; // only checked, the callsite info takes the object itself
+
+    JSNApi::NapiSetPropertyWithCallsiteInfo(
+        vm, reinterpret_cast<uintptr_t>(object),
+        reinterpret_cast<uintptr_t>(JsValueFromLocalValue(key)),
+        reinterpret_cast<uintptr_t>(value),
+        callsite,
+        nullptr);
+
+    return GET_RETURN_STATUS(env);
+}
+
+// Creates the keys and callsite infos of |accessors| that are new in |env|, so the bulk accessors do not allocate them
+// in their fast native scope.
+static napi_status PrepareNamedAccessors(napi_env env, size_t count, napi_named_accessor* accessors)
+{
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    auto vm = engine->GetEcmaVm();
+    ArkNamedAccessorCache& cache = engine->GetNamedAccessorCache();
+    Local<panda::StringRef> key;
+    uintptr_t callsite = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (accessors[i].name == nullptr) {
+            return napi_invalid_arg;
+        }
+        if (!cache.Get(vm, &accessors[i], key, callsite)) {
+            return napi_generic_failure;
+        }
+    }
+    return napi_ok;
+}
+
+NAPI_EXTERN napi_status napi_get_named_properties(napi_env env,
+                                                 napi_value object,
+                                                 size_t property_count,
+                                                 napi_named_accessor* accessors,
+                                                 napi_value* values)
+{
+    NAPI_PREAMBLE(env);
+    CHECK_ARG(env, object);
+    if (property_count > 0) {
+        CHECK_ARG(env, accessors);
+        CHECK_ARG(env, values);
+    }
+
+    SWITCH_CONTEXT(env);
+    napi_status status = PrepareNamedAccessors(env, property_count, accessors);
+    RETURN_STATUS_IF_FALSE(env, status == napi_ok, status);
+    auto vm = engine->GetEcmaVm();
+    ArkNamedAccessorCache& cache = reinterpret_cast<ArkNativeEngine*>(env)->GetNamedAccessorCache();
+    panda::JsiFastNativeScope fastNativeScope(vm);
+    Local<panda::StringRef> key;
+    uintptr_t callsite = 0;
+    for (size_t i = 0; i < property_count && !tryCatch.HasCaught(); i++) {
+        cache.Get(vm, &accessors[i], key, callsite);
+        Local<panda::JSValueRef> value = JSNApi::NapiGetPropertyWithCallsiteInfo(
+            vm, reinterpret_cast<uintptr_t>(object),
+            reinterpret_cast<uintptr_t>(JsValueFromLocalValue(key)),
+            callsite,
+            nullptr);
+        RETURN_STATUS_IF_FALSE(env, NapiStatusValidationCheck(value), napi_object_expected);
+#ifdef ENABLE_CONTAINER_SCOPE
+        FunctionSetContainerId(env, value);
+#endif
+        values[i] = JsValueFromLocalValue(value);
+    }
+
+    return GET_RETURN_STATUS(env);
+}
+
+NAPI_EXTERN napi_status napi_set_named_properties(napi_env env,
+                                                 napi_value object,
+                                                 size_t property_count,
+                                                 napi_named_accessor* accessors,
+                                                 const napi_value* values)
+{
+    NAPI_PREAMBLE(env);
+    CHECK_ARG(env, object);
+    if (property_count > 0) {
+        CHECK_ARG(env, accessors);
+        CHECK_ARG(env, values);
+    }
+    for (size_t i = 0; i < property_count; i++) {
+        CHECK_ARG(env, values[i]);
+    }
+
+    SWITCH_CONTEXT(env);
+    napi_status status = PrepareNamedAccessors(env, property_count, accessors);
+    RETURN_STATUS_IF_FALSE(env, status == napi_ok, status);
+    auto vm = engine->GetEcmaVm();
+    ArkNamedAccessorCache& cache = reinterpret_cast<ArkNativeEngine*>(env)->GetNamedAccessorCache();
+    panda::JsiFastNativeScope fastNativeScope(vm);
+    auto nativeValue = LocalValueFromJsValue(object);
+    CHECK_AND_CONVERT_TO_OBJECT(env, vm, nativeValue, obj);
+    (void)obj; // only checked, the callsite infos take the object itself
+
+    Local<panda::StringRef> key;
+    uintptr_t callsite = 0;
+    for (size_t i = 0; i < property_count && !tryCatch.HasCaught(); i++) {
+        cache.Get(vm, &accessors[i], key, callsite);
+        JSNApi::NapiSetPropertyWithCallsiteInfo(
+            vm, reinterpret_cast<uintptr_t>(object),
+            reinterpret_cast<uintptr_t>(JsValueFromLocalValue(key)),
+            reinterpret_cast<uintptr_t>(values[i]),
+            callsite,
+            nullptr);
+    }
+
+    return GET_RETURN_STATUS(env);
+}
+
 NAPI_EXTERN napi_status napi_get_global_handle_count(napi_env env, size_t* count)
 {
     NAPI_PREAMBLE(env);
@@ -1612,6 +1779,173 @@ NAPI_EXTERN napi_status napi_get_cb_info(napi_env env,              // [in] NAPI
     return napi_clear_last_error(env);
 }
 
+// a UTF-8 character takes up to 4 bytes, a copy ending closer than that to the end of its buffer may be truncated
+static constexpr size_t UTF8_MAX_CHAR_BYTES = 4;
+
+static napi_status ConvertCallbackArg(const EcmaVM* vm, Local<panda::JSValueRef> value, char type, void* result,
+                                      size_t bufsize, size_t* length)
+{
+    bool isType = false;
+    switch (type) {
+        case 'b': {
+            bool bValue = value->GetValueBool(isType);
+            if (!isType) {
+                return napi_boolean_expected;
+            }
+            *static_cast<bool*>(result) = bValue;
+            return napi_ok;
+        }
+        case 'i': {
+            int32_t i32Value = value->GetValueInt32(isType);
+            if (!isType) {
+                return napi_number_expected;
+            }
+            *static_cast<int32_t*>(result) = i32Value;
+            return napi_ok;
+        }
+        case 'u': {
+            uint32_t u32Value = value->GetValueUint32(isType);
+            if (!isType) {
+                return napi_number_expected;
+            }
+            *static_cast<uint32_t*>(result) = u32Value;
+            return napi_ok;
+        }
+        case 'l': {
+            int64_t i64Value = value->GetValueInt64(isType);
+            if (!isType) {
+                return napi_number_expected;
+            }
+            *static_cast<int64_t*>(result) = i64Value;
+            return napi_ok;
+        }
+        case 'd': {
+            double dValue = value->GetValueDouble(isType);
+            if (!isType) {
+                return napi_number_expected;
+            }
+            *static_cast<double*>(result) = dValue;
+            return napi_ok;
+        }
+        case 's': {
+            if (!value->IsStringWithoutSwitchState(vm)) {
+                return napi_string_expected;
+            }
+            Local<panda::StringRef> stringVal(value);
+            char* buf = static_cast<char*>(result);
+            size_t copied = 0;
+            if (buf != nullptr && LIKELY(bufsize != 0)) {
+                copied = stringVal->WriteUtf8(vm, buf, bufsize - 1, true) - 1;
+                buf[copied] = '\0';
+            }
+            if (length != nullptr) {
+                // the full length, so the caller sees a truncated copy, only measured when it may be one
+                bool mayTruncate = buf == nullptr || bufsize == 0 || bufsize - 1 - copied < UTF8_MAX_CHAR_BYTES;
+                *length = mayTruncate ? stringVal->Utf8Length(vm, true) - 1 : copied;
+            }
+            return napi_ok;
+        }
+        case 'o':
+            if (!(value->IsObjectWithoutSwitchState(vm) || value->IsFunction(vm))) {
+                return napi_object_expected;
+            }
+            break;
+        case 'f':
+            if (!value->IsFunction(vm)) {
+                return napi_function_expected;
+            }
+            break;
+        default:
+            break;
+    }
+    *static_cast<napi_value*>(result) = JsValueFromLocalValue(value);
+    return napi_ok;
+}
+
+// Converts the arguments of a callback in one call, see native_node_api.h for the format.
+NAPI_EXTERN napi_status napi_get_cb_args(napi_env env, napi_callback_info cbinfo, const char* format, ...)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, cbinfo);
+    CHECK_ARG(env, format);
+
+    auto info = reinterpret_cast<panda::JsiRuntimeCallInfo*>(cbinfo);
+    auto vm = info->GetVM();
+    panda::JsiFastNativeScope fastNativeScope(vm);
+    size_t argc = static_cast<size_t>(info->GetArgsNumber());
+    size_t index = 0;
+    bool optional = false;
+    napi_status status = napi_ok;
+    va_list args;
+    va_start(args, format);
+    for (const char* type = format; *type != '\0' && status == napi_ok; type++) {
+        if (*type == ' ') {
+            continue;
+        }
+        if (*type == '|') {
+            status = optional ? napi_invalid_arg : napi_ok;
+            optional = true;
+            continue;
+        }
+        void* result = nullptr;
+        size_t bufsize = 0;
+        size_t* length = nullptr;
+        switch (*type) {
+            case 'b':
+                result = va_arg(args, bool*);
+                break;
+            case 'i':
+                result = va_arg(args, int32_t*);
+                break;
+            case 'u':
+                result = va_arg(args, uint32_t*);
+                break;
+            case 'l':
+                result = va_arg(args, int64_t*);
+                break;
+            case 'd':
+                result = va_arg(args, double*);
+                break;
+            case 's':
+                result = va_arg(args, char*);
+                bufsize = va_arg(args, size_t);
+                length = va_arg(args, size_t*);
+                break;
+            case 'o':
+            case 'f':
+            case 'v':
+                result = va_arg(args, napi_value*);
+                break;
+            default:
+                HILOG_ERROR("unknown argument type '%{public}c' in format", *type);
+                break;
+        }
+        // only measuring a string needs no buffer
+        if (result == nullptr && length == nullptr) {
+            status = napi_invalid_arg;
+            break;
+        }
+        if (index >= argc) {
+            // missing optional arguments leave their outputs as they are
+            status = optional ? napi_ok : napi_invalid_arg;
+            continue;
+        }
+        Local<panda::JSValueRef> value = info->GetCallArgRef(index++);
+        if (optional && value->IsUndefined()) {
+            continue;
+        }
+#ifdef ENABLE_CONTAINER_SCOPE
+        if (*type == 'f' || *type == 'v') {
+            FunctionSetContainerId(env, value);
+        }
+#endif
+        status = ConvertCallbackArg(vm, value, *type, result, bufsize, length);
+    }
+    va_end(args);
+
+    return status == napi_ok ? napi_clear_last_error(env) : napi_set_last_error(env, status);
+}
+
 NAPI_EXTERN napi_status napi_get_new_target(napi_env env, napi_callback_info cbinfo, napi_value* result)
 {
     NAPI_PREAMBLE(env);
@@ -2166,10 +2500,12 @@ NAPI_EXTERN napi_status napi_wrap_enhance(napi_env env,
         }
     } else {
         if (reference != nullptr) {
-            ref = engine->CreateAsyncReference(js_object, 1, false, callback, native_object, finalize_hint);
+            ref = engine->CreateAsyncReference(js_object, 1, false, callback, native_object, finalize_hint,
+                                               native_binding_size);
             *reference = ref;
         } else {
-            ref = engine->CreateAsyncReference(js_object, 0, true, callback, native_object, finalize_hint);
+            ref = engine->CreateAsyncReference(js_object, 0, true, callback, native_object, finalize_hint,
+                                               native_binding_size);
         }
     }
     object->SetNativePointerFieldCount(vm, 1);
@@ -2180,14 +2516,14 @@ NAPI_EXTERN napi_status napi_wrap_enhance(napi_env env,
     return GET_RETURN_STATUS(env);
 }
 
-// Ensure thread safety! Async finalizer will be called on the async thread.
-NAPI_EXTERN napi_status napi_wrap_async_finalizer(napi_env env,
-                                                  napi_value js_object,
-                                                  void* native_object,
-                                                  napi_finalize finalize_cb,
-                                                  void* finalize_hint,
-                                                  napi_ref* result,
-                                                  size_t native_binding_size)
+static napi_status WrapAsyncFinalizer(napi_env env,
+                                      napi_value js_object,
+                                      void* native_object,
+                                      napi_finalize finalize_cb,
+                                      void* finalize_hint,
+                                      napi_ref* result,
+                                      size_t native_binding_size,
+                                      bool concurrent)
 {
     NAPI_PREAMBLE(env);
     CHECK_ARG(env, js_object);
@@ -2206,11 +2542,17 @@ NAPI_EXTERN napi_status napi_wrap_async_finalizer(napi_env env,
     }
     Local<panda::ObjectRef> object = panda::ObjectRef::NewWrappedNapiObject(vm);
     NativeReference* ref = nullptr;
+    uint32_t initialRefcount = reference != nullptr ? 1 : 0;
+    bool deleteSelf = reference == nullptr;
+    if (concurrent) {
+        ref = engine->CreateConcurrentReference(js_object, initialRefcount, deleteSelf, callback, native_object,
+                                                finalize_hint, native_binding_size);
+    } else {
+        ref = engine->CreateAsyncReference(js_object, initialRefcount, deleteSelf, callback, native_object,
+                                           finalize_hint, native_binding_size);
+    }
     if (reference != nullptr) {
-        ref = engine->CreateAsyncReference(js_object, 1, false, callback, native_object, finalize_hint);
         *reference = ref;
-    } else {
-        ref = engine->CreateAsyncReference(js_object, 0, true, callback, native_object, finalize_hint);
     }
     object->SetNativePointerFieldCount(vm, 1);
     object->SetNativePointerField(vm, 0, ref, nullptr, nullptr, native_binding_size);
@@ -2219,6 +2561,61 @@ NAPI_EXTERN napi_status napi_wrap_async_finalizer(napi_env env,
     return GET_RETURN_STATUS(env);
 }
 
+// Ensure thread safety! Async finalizer will be called on the async thread.
+NAPI_EXTERN napi_status napi_wrap_async_finalizer(napi_env env,
+                                                  napi_value js_object,
+                                                  void* native_object,
+                                                  napi_finalize finalize_cb,
+                                                  void* finalize_hint,
+                                                  napi_ref* result,
+                                                  size_t native_binding_size)
+{
+    return WrapAsyncFinalizer(env, js_object, native_object, finalize_cb, finalize_hint, result,
+                              native_binding_size, false);
+}
+
+// Ensure thread safety! Concurrent finalizers run on several background threads at once.
+NAPI_EXTERN napi_status napi_wrap_concurrent_finalizer(napi_env env,
+                                                       napi_value js_object,
+                                                       void* native_object,
+                                                       napi_finalize finalize_cb,
+                                                       void* finalize_hint,
+                                                       napi_ref* result,
+                                                       size_t native_binding_size)
+{
+    return WrapAsyncFinalizer(env, js_object, native_object, finalize_cb, finalize_hint, result,
+                              native_binding_size, true);
+}
+
+NAPI_EXTERN napi_status napi_get_finalizer_stats(napi_env env, napi_finalizer_stats* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    const ArkNativeEngine* rootEngine = engine->IsMainEnvContext() ? engine : engine->GetParent();
+    const ArkFinalizersStats& stats = rootEngine->GetFinalizersStats();
+    result->packs = stats.packs.load(std::memory_order_relaxed);
+    result->finalizers = stats.finalizers.load(std::memory_order_relaxed);
+    result->last_pack_us = stats.lastPackUs.load(std::memory_order_relaxed);
+    result->max_pack_us = stats.maxPackUs.load(std::memory_order_relaxed);
+    result->total_pack_us = stats.totalPackUs.load(std::memory_order_relaxed);
+    result->concurrent_shards = stats.concurrentShards.load(std::memory_order_relaxed);
+    result->concurrent_finalizers = stats.concurrentFinalizers.load(std::memory_order_relaxed);
+    result->max_shard_us = stats.maxShardUs.load(std::memory_order_relaxed);
+    result->slices = stats.slices.load(std::memory_order_relaxed);
+    result->idle_slices = stats.idleSlices.load(std::memory_order_relaxed);
+    result->max_slice_us = stats.maxSliceUs.load(std::memory_order_relaxed);
+    result->sync_drains = stats.syncDrains.load(std::memory_order_relaxed);
+    result->backlog = stats.backlog.load(std::memory_order_relaxed);
+    result->async_batches = stats.asyncBatches.load(std::memory_order_relaxed);
+    result->async_finalizers = stats.asyncFinalizers.load(std::memory_order_relaxed);
+    result->max_async_batch_us = stats.maxAsyncBatchUs.load(std::memory_order_relaxed);
+    result->async_sync_batches = stats.asyncSyncBatches.load(std::memory_order_relaxed);
+    result->async_backlog = stats.asyncBacklog.load(std::memory_order_relaxed);
+    return napi_clear_last_error(env);
+}
+
 // Methods to work with external data objects
 NAPI_EXTERN napi_status napi_wrap_with_size(napi_env env,
                                             napi_value js_object,
@@ -2485,6 +2882,41 @@ NAPI_EXTERN napi_status napi_get_value_external(napi_env env, napi_value value,
     return napi_clear_last_error(env);
 }
 
+// VM to record global ref mappings in for heap snapshot tracking, nullptr when tracking is off.
+static inline EcmaVM* GetGlobalRefTrackingVm(ArkNativeEngine* engine)
+{
+    if (engine->IsInDestructor() || !panda::JSNApi::IsTrackGlobalRefEnabled()) {
+        return nullptr;
+    }
+    return const_cast<EcmaVM*>(engine->GetEcmaVm());
+}
+
+static inline void TrackGlobalRef(EcmaVM* vm, NativeReference* ref)
+{
+    uintptr_t slotAddress = ref->GetGlobalRefSlotAddress();
+    if (slotAddress != 0) {
+        panda::JSNApi::StoreGlobalRefMapping(vm, slotAddress, reinterpret_cast<void*>(ref));
+    }
+}
+
+static inline void DeleteReference(EcmaVM* trackingVm, NativeReference* reference)
+{
+    // Unregister global ref mapping before deletion
+    if (trackingVm != nullptr) {
+        uintptr_t slotAddress = reference->GetGlobalRefSlotAddress();
+        if (slotAddress != 0) {
+            panda::JSNApi::EraseGlobalRefMapping(trackingVm, slotAddress);
+        }
+    }
+
+    uint32_t refCount = reference->GetRefCount();
+    if (refCount > 0 || reference->GetFinalRun()) {
+        delete reference;
+    } else {
+        reference->SetDeleteSelf();
+    }
+}
+
 // Methods to control object lifespan
 // Set initial_refcount to 0 for a weak reference, >0 for a strong reference.
 NAPI_EXTERN napi_status napi_create_reference(napi_env env,
@@ -2496,17 +2928,12 @@ NAPI_EXTERN napi_status napi_create_reference(napi_env env,
     CHECK_ARG(env, value);
     CHECK_ARG(env, result);
     auto engine = reinterpret_cast<ArkNativeEngine*>(env);
-    auto ref = new ArkNativeReference(engine, value, initial_refcount);
+    auto ref = new (engine->GetReferenceManager()) ArkNativeReference(engine, value, initial_refcount);
 
     // Register global ref mapping for heap snapshot tracking
-    if (!engine->IsInDestructor() && panda::JSNApi::IsTrackGlobalRefEnabled()) {
-        uintptr_t slotAddress = ref->GetGlobalRefSlotAddress();
-        if (slotAddress != 0) {
-            EcmaVM* vm = const_cast<EcmaVM*>(engine->GetEcmaVm());
-            if (vm != nullptr) {
-                panda::JSNApi::StoreGlobalRefMapping(vm, slotAddress, reinterpret_cast<void*>(ref));
-            }
-        }
+    EcmaVM* trackingVm = GetGlobalRefTrackingVm(engine);
+    if (trackingVm != nullptr) {
+        TrackGlobalRef(trackingVm, ref);
     }
 
     *result = reinterpret_cast<napi_ref>(ref);
@@ -2520,27 +2947,67 @@ NAPI_EXTERN napi_status napi_delete_reference(napi_env env, napi_ref ref)
     CHECK_ENV(env);
     CHECK_ARG(env, ref);
 
-    auto reference = reinterpret_cast<NativeReference*>(ref);
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    DeleteReference(GetGlobalRefTrackingVm(engine), reinterpret_cast<NativeReference*>(ref));
+
+    return napi_clear_last_error(env);
+}
+
+// Same as napi_create_reference for each of |values|, the storage of all references is taken at once.
+// Nothing is created when one of |values| is nullptr.
+NAPI_EXTERN napi_status napi_create_references(napi_env env,
+                                               size_t count,
+                                               const napi_value* values,
+                                               uint32_t initial_refcount,
+                                               napi_ref* results)
+{
+    CHECK_ENV(env);
+    if (count == 0) {
+        return napi_clear_last_error(env);
+    }
+    CHECK_ARG(env, values);
+    CHECK_ARG(env, results);
+    for (size_t i = 0; i < count; i++) {
+        CHECK_ARG(env, values[i]);
+    }
 
-    // Unregister global ref mapping before deletion
     auto engine = reinterpret_cast<ArkNativeEngine*>(env);
-    if (!engine->IsInDestructor() && panda::JSNApi::IsTrackGlobalRefEnabled()) {
-        uintptr_t slotAddress = reference->GetGlobalRefSlotAddress();
-        if (slotAddress != 0) {
-            EcmaVM* vm = const_cast<EcmaVM*>(engine->GetEcmaVm());
-            if (vm != nullptr) {
-                panda::JSNApi::EraseGlobalRefMapping(vm, slotAddress);
-            }
+    auto refs = reinterpret_cast<NativeReference**>(results);
+    size_t created = engine->CreateReferences(values, count, initial_refcount, refs);
+    if (created < count) {
+        HILOG_ERROR("created %{public}zu of %{public}zu references", created, count);
+        for (size_t i = 0; i < created; i++) {
+            delete refs[i];
+            refs[i] = nullptr;
         }
+        return napi_set_last_error(env, napi_generic_failure);
     }
 
-    uint32_t refCount = reference->GetRefCount();
-    if (refCount > 0 || reference->GetFinalRun()) {
-        delete reference;
-    } else {
-        reference->SetDeleteSelf();
+    EcmaVM* trackingVm = GetGlobalRefTrackingVm(engine);
+    if (trackingVm != nullptr) {
+        for (size_t i = 0; i < count; i++) {
+            TrackGlobalRef(trackingVm, refs[i]);
+        }
+    }
+    return napi_clear_last_error(env);
+}
+
+// Same as napi_delete_reference for each of |refs|. Nothing is deleted when one of |refs| is nullptr.
+NAPI_EXTERN napi_status napi_delete_references(napi_env env, size_t count, const napi_ref* refs)
+{
+    CHECK_ENV(env);
+    if (count == 0) {
+        return napi_clear_last_error(env);
+    }
+    CHECK_ARG(env, refs);
+    for (size_t i = 0; i < count; i++) {
+        CHECK_ARG(env, refs[i]);
     }
 
+    EcmaVM* trackingVm = GetGlobalRefTrackingVm(reinterpret_cast<ArkNativeEngine*>(env));
+    for (size_t i = 0; i < count; i++) {
+        DeleteReference(trackingVm, reinterpret_cast<NativeReference*>(refs[i]));
+    }
     return napi_clear_last_error(env);
 }
 
@@ -3482,6 +3949,211 @@ NAPI_INNER_EXTERN napi_status napi_adjust_external_memory(
     return napi_clear_last_error(env);
 }
 
+// Copies a text report like napi_get_value_string_utf8: with buf nullptr, result receives the full length.
+static napi_status CopyDump(napi_env env, const std::string& dump, char* buf, size_t bufsize, size_t* result)
+{
+    if (buf == nullptr) {
+        *result = dump.size();
+    } else if (bufsize != 0) {
+        size_t copied = std::min(dump.size(), bufsize - 1);
+        if (memcpy_s(buf, bufsize, dump.data(), copied) != EOK) {
+            HILOG_ERROR("memcpy_s failed");
+            return napi_set_last_error(env, napi_generic_failure);
+        }
+        buf[copied] = '\0';
+        *result = copied;
+    } else {
+        *result = 0;
+    }
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_native_memory_info(napi_env env, napi_native_memory_info* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    ArkNativeEngine* rootEngine =
+        engine->IsMainEnvContext() ? engine : const_cast<ArkNativeEngine*>(engine->GetParent());
+    const NativeMemoryAccounting& accounting = rootEngine->GetMemoryAccounting();
+    result->binding_objects = accounting.GetBindingObjects();
+    result->binding_bytes = accounting.GetBindingBytes();
+    result->external_bytes = accounting.GetExternalBytes();
+    result->peak_bytes = accounting.GetPeakBytes();
+    result->gc_requests = accounting.GetGCRequests();
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_dump_native_memory(napi_env env,
+                                                size_t max_entries,
+                                                char* buf,
+                                                size_t bufsize,
+                                                size_t* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    ArkNativeEngine* rootEngine =
+        engine->IsMainEnvContext() ? engine : const_cast<ArkNativeEngine*>(engine->GetParent());
+    return CopyDump(env, rootEngine->GetMemoryAccounting().Dump(max_entries), buf, bufsize, result);
+}
+
+NAPI_EXTERN napi_status napi_set_reference_sampling(napi_env env, uint32_t interval, bool capture_js_stack)
+{
+    CHECK_ENV(env);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    ArkNativeEngine* rootEngine =
+        engine->IsMainEnvContext() ? engine : const_cast<ArkNativeEngine*>(engine->GetParent());
+    rootEngine->GetReferenceLeakTracker().SetInterval(interval, capture_js_stack);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_dump_reference_sites(napi_env env,
+                                                  size_t max_sites,
+                                                  char* buf,
+                                                  size_t bufsize,
+                                                  size_t* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    ArkNativeEngine* rootEngine =
+        engine->IsMainEnvContext() ? engine : const_cast<ArkNativeEngine*>(engine->GetParent());
+    return CopyDump(env, rootEngine->GetReferenceLeakTracker().Dump(max_sites), buf, bufsize, result);
+}
+
+NAPI_EXTERN napi_status napi_dump_references_by_finalizer(napi_env env,
+                                                          size_t max_entries,
+                                                          char* buf,
+                                                          size_t bufsize,
+                                                          size_t* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    NativeReferenceManager* manager = reinterpret_cast<NativeEngine*>(env)->GetReferenceManager();
+    RETURN_STATUS_IF_FALSE(env, manager != nullptr, napi_generic_failure);
+    return CopyDump(env, manager->DumpReferencesByFinalizer(max_entries), buf, bufsize, result);
+}
+
+NAPI_EXTERN napi_status napi_create_strong_handle(napi_env env, napi_value value, napi_strong_handle* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, value);
+    CHECK_ARG(env, result);
+    CROSS_THREAD_CHECK(env);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    uint32_t id = engine->GetHandleTable().Create(engine->GetEcmaVm(), LocalValueFromJsValue(value));
+    if (id == ArkNativeHandleTable::INVALID_ID) {
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+    *result = id;
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_strong_handle_value(napi_env env, napi_strong_handle handle, napi_value* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+    CROSS_THREAD_CHECK(env);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    Local<panda::JSValueRef> value = engine->GetHandleTable().Get(engine->GetEcmaVm(), handle);
+    RETURN_STATUS_IF_FALSE(env, !value.IsEmpty(), napi_invalid_arg);
+    *result = JsValueFromLocalValue(value);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_set_strong_handle_value(napi_env env, napi_strong_handle handle, napi_value value)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, value);
+    CROSS_THREAD_CHECK(env);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    bool set = engine->GetHandleTable().Set(engine->GetEcmaVm(), handle, LocalValueFromJsValue(value));
+    RETURN_STATUS_IF_FALSE(env, set, napi_invalid_arg);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_delete_strong_handle(napi_env env, napi_strong_handle handle)
+{
+    CHECK_ENV(env);
+    CROSS_THREAD_CHECK(env);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    bool deleted = engine->GetHandleTable().Delete(engine->GetEcmaVm(), handle);
+    RETURN_STATUS_IF_FALSE(env, deleted, napi_invalid_arg);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_create_weak_table(napi_env env,
+                                               napi_weak_table_callback callback,
+                                               void* data,
+                                               napi_weak_table* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<ArkNativeEngine*>(env);
+    auto table = new ArkNativeWeakTable(engine, callback, data);
+    *result = reinterpret_cast<napi_weak_table>(table);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_weak_table_set(napi_env env, napi_weak_table table, void* key, napi_value value)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, table);
+    CHECK_ARG(env, value);
+
+    reinterpret_cast<ArkNativeWeakTable*>(table)->Set(key, value);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_weak_table_get(napi_env env, napi_weak_table table, void* key, napi_value* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, table);
+    CHECK_ARG(env, result);
+
+    *result = reinterpret_cast<ArkNativeWeakTable*>(table)->Get(key);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_weak_table_delete(napi_env env, napi_weak_table table, void* key)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, table);
+
+    reinterpret_cast<ArkNativeWeakTable*>(table)->Delete(key);
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_weak_table_size(napi_env env, napi_weak_table table, size_t* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, table);
+    CHECK_ARG(env, result);
+
+    *result = reinterpret_cast<ArkNativeWeakTable*>(table)->Size();
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_delete_weak_table(napi_env env, napi_weak_table table)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, table);
+
+    ArkNativeWeakTable::Destroy(reinterpret_cast<ArkNativeWeakTable*>(table));
+    return napi_clear_last_error(env);
+}
+
 NAPI_EXTERN napi_status napi_is_callable(napi_env env, napi_value value, bool* result)
 {
     CHECK_ENV(env);
@@ -4376,6 +5048,65 @@ NAPI_EXTERN napi_status napi_queue_async_work_with_qos(napi_env env, napi_async_
     return napi_status::napi_ok;
 }
 
+NAPI_EXTERN napi_status napi_start_async_work_pool(napi_env env, size_t thread_count)
+{
+    CHECK_ENV(env);
+
+    if (!NativeWorkStealingPool::GetInstance().Start(thread_count)) {
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_stop_async_work_pool(napi_env env)
+{
+    CHECK_ENV(env);
+
+    NativeWorkStealingPool::GetInstance().Stop();
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_queue_async_work_with_deadline(napi_env env,
+                                                            napi_async_work work,
+                                                            napi_qos_t qos,
+                                                            uint64_t timeout_ms)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, work);
+    RETURN_STATUS_IF_FALSE(env, timeout_ms > 0, napi_invalid_arg);
+
+    auto asyncWork = reinterpret_cast<NativeAsyncWork*>(work);
+    if (!asyncWork->QueueWithDeadline(reinterpret_cast<NativeEngine*>(env), qos, timeout_ms)) {
+        HILOG_ERROR("QueueWithDeadline failed");
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+    return napi_clear_last_error(env);
+}
+
+// Polled from worker threads, the last error of env is left untouched.
+NAPI_EXTERN napi_status napi_is_async_work_cancelled(napi_env env, napi_async_work work, bool* result)
+{
+    CHECK_ENV(env);
+    CHECK_ENV(work);
+    CHECK_ENV(result);
+
+    *result = reinterpret_cast<NativeAsyncWork*>(work)->IsCancelled();
+    return napi_ok;
+}
+
+NAPI_EXTERN napi_status napi_get_async_work_cache_stats(napi_env env, uint64_t* hits, uint64_t* misses)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, hits);
+    CHECK_ARG(env, misses);
+
+    NativeAsyncWorkCacheStats stats;
+    reinterpret_cast<NativeEngine*>(env)->GetAsyncWorkCache().GetStats(stats);
+    *hits = stats.hits;
+    *misses = stats.misses;
+    return napi_clear_last_error(env);
+}
+
 NAPI_EXTERN napi_status napi_queue_async_work_with_queue(napi_env env,
                                                          napi_async_work work,
                                                          napi_qos_t qos,
@@ -4394,6 +5125,38 @@ NAPI_EXTERN napi_status napi_queue_async_work_with_queue(napi_env env,
     return napi_status::napi_ok;
 }
 
+NAPI_EXTERN napi_status napi_get_async_work_queue_stats(napi_env env, napi_async_work_queue_stats* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    auto engine = reinterpret_cast<NativeEngine*>(env);
+    NativeEngine* loopEngine = engine->IsMainEnvContext() ? engine : engine->GetParent();
+    NativeSerialExecutorStats stats;
+    loopEngine->GetSerialExecutors().GetStats(stats);
+    result->active_queues = stats.activeQueues;
+    result->pending = stats.pending;
+    result->executed = stats.executed;
+    result->rejected = stats.rejected;
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_reference_memory_stats(napi_env env, napi_reference_memory_stats* result)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, result);
+
+    NativeReferenceManager* manager = reinterpret_cast<NativeEngine*>(env)->GetReferenceManager();
+    RETURN_STATUS_IF_FALSE(env, manager != nullptr, napi_generic_failure);
+    NativeReferenceMemoryStats stats;
+    manager->GetMemoryStats(stats);
+    result->live_references = stats.references.liveBlocks;
+    result->free_reference_slots = stats.references.freeBlocks;
+    result->live_sendable_references = stats.sendableReferences.liveBlocks;
+    result->reserved_bytes = stats.references.reservedBytes + stats.sendableReferences.reservedBytes;
+    return napi_clear_last_error(env);
+}
+
 static void* DetachFuncCallback(void* engine, void* object, void* hint, void* detachData)
 {
     if (detachData == nullptr || (engine == nullptr || object == nullptr)) {
@@ -4632,6 +5395,10 @@ NAPI_EXTERN napi_status napi_call_threadsafe_function_with_priority(napi_threads
         return napi_status::napi_invalid_arg;
     }
     auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
+    if (safeAsyncWork->HasInlinePayload()) {
+        HILOG_ERROR("threadsafe function with inline payload only accepts payload calls");
+        return napi_status::napi_invalid_arg;
+    }
     int32_t innerPriority = static_cast<int32_t>(priority);
     auto res = safeAsyncWork->PostTask(data, innerPriority, isTail);
     if (res != napi_ok) {
@@ -4640,6 +5407,34 @@ NAPI_EXTERN napi_status napi_call_threadsafe_function_with_priority(napi_threads
     return res;
 }
 
+NAPI_EXTERN napi_status napi_set_threadsafe_function_batch_callback(
+    napi_env env, napi_threadsafe_function func, napi_threadsafe_function_call_js_batch call_js_batch_cb)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, func);
+    CHECK_ARG(env, call_js_batch_cb);
+
+    auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
+    auto callJsBatchCallback = reinterpret_cast<NativeThreadSafeFunctionCallJsBatch>(call_js_batch_cb);
+    if (!safeAsyncWork->SetBatchCallJsCallback(callJsBatchCallback)) {
+        return napi_set_last_error(env, napi_generic_failure);
+    }
+    return napi_clear_last_error(env);
+}
+
+NAPI_EXTERN napi_status napi_get_threadsafe_function_wakeup_stats(napi_threadsafe_function func,
+                                                                  uint64_t* sent,
+                                                                  uint64_t* elided)
+{
+    CHECK_ENV(func);
+    CHECK_ENV(sent);
+    CHECK_ENV(elided);
+
+    auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
+    safeAsyncWork->GetWakeupCounters(*sent, *elided);
+    return napi_status::napi_ok;
+}
+
 NAPI_EXTERN napi_status napi_open_fast_native_scope(napi_env env, napi_fast_native_scope* scope)
 {
     CHECK_ENV(env);
@@ -4916,7 +5711,7 @@ NAPI_EXTERN napi_status napi_create_strong_sendable_reference(napi_env env,
         return napi_set_last_error(env, napi_object_expected);
     }
 
-    auto ref = new ArkSendableNativeReference(engine, nativeValue);
+    auto ref = new (engine->GetReferenceManager()) ArkSendableNativeReference(engine, nativeValue);
 
     *result = reinterpret_cast<napi_sendable_ref>(ref);
     return napi_clear_last_error(env);
@@ -22,8 +22,11 @@
 #ifdef ENABLE_CONTAINER_SCOPE
 #include "native_container_scope.h"
 #endif
+#include <chrono>
 #include <cinttypes>
+#include <limits>
 #include "native_api_internal.h"
+#include "native_work_stealing_pool.h"
 
 #ifdef ENABLE_HITRACE
 std::atomic<bool> g_napiTraceIdEnabled(false);
@@ -32,20 +35,38 @@ constexpr size_t TRACE_BUFFER_SIZE = 120;
 constexpr size_t TRACEID_PARAM_SIZE = 10;
 const std::string TRACE_POINT_QUEUE = "napi::NativeAsyncWork::Queue";
 const std::string TRACE_POINT_QUEUE_WITH_QOS = "napi::NativeAsyncWork::QueueWithQos";
+const std::string TRACE_POINT_QUEUE_TO_POOL = "napi::NativeAsyncWork::QueueToPool";
 const std::string TRACE_POINT_QUEUE_ORDERED = "napi::NativeAsyncWork::QueueOrdered";
 const std::string TRACE_POINT_ASYNCWORKCALLBACK = "napi::NativeAsyncWork::AsyncWorkCallback";
 using namespace OHOS::HiviewDFX;
 #endif
 
+static constexpr uint64_t NS_PER_MS = 1000000;
+
+static uint64_t GetSteadyTimeNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
 NativeAsyncWork::NativeAsyncWork(NativeEngine* engine,
                                  NativeAsyncExecuteCallback execute,
                                  NativeAsyncCompleteCallback complete,
                                  const std::string &asyncResourceName,
                                  void* data)
+    : NativeAsyncWork(engine, execute, complete, asyncResourceName.c_str(), data)
+{
+}
+
+NativeAsyncWork::NativeAsyncWork(NativeEngine* engine,
+                                 NativeAsyncExecuteCallback execute,
+                                 NativeAsyncCompleteCallback complete,
+                                 const char* asyncResourceName,
+                                 void* data)
     : work_({ 0 }), engine_(engine), engineId_(engine->GetId()), execute_(execute), complete_(complete), data_(data)
 {
     work_.data = this;
-    taskName_ = asyncResourceName;
+    InitTaskName(asyncResourceName);
 #ifdef ENABLE_HITRACE
     if (!g_ParamUpdated.load()) {
         char napiTraceIdEnabled[TRACEID_PARAM_SIZE] = {0};
@@ -69,7 +90,7 @@ NativeAsyncWork::NativeAsyncWork(NativeEngine* engine,
     char traceStr[TRACE_BUFFER_SIZE] = {0};
     if (sprintf_s(traceStr, sizeof(traceStr),
         "name:%s#%" PRIuPTR ", traceid:0x%x",
-        asyncResourceName.c_str(),
+        asyncResourceName,
         reinterpret_cast<uintptr_t>(this),
         taskTraceId_.GetChainId()) < 0) {
         HILOG_ERROR("Get traceStr fail");
@@ -88,9 +109,48 @@ NativeAsyncWork::NativeAsyncWork(NativeEngine* engine,
 
 NativeAsyncWork::~NativeAsyncWork() = default;
 
+NativeAsyncWork* NativeAsyncWork::Create(NativeEngine* engine,
+                                         NativeAsyncExecuteCallback execute,
+                                         NativeAsyncCompleteCallback complete,
+                                         const char* asyncResourceName,
+                                         void* data)
+{
+    void* block = engine->GetAsyncWorkCache().Allocate();
+    if (block == nullptr) {
+        HILOG_ERROR("failed to allocate async work");
+        return nullptr;
+    }
+    auto work = new (block) NativeAsyncWork(engine, execute, complete, asyncResourceName, data);
+    work->pooled_ = true;
+    return work;
+}
+
+void NativeAsyncWork::Destroy(NativeEngine* engine, NativeAsyncWork* work)
+{
+    if (work == nullptr) {
+        return;
+    }
+    if (!work->pooled_) {
+        delete work;
+        return;
+    }
+    work->~NativeAsyncWork();
+    engine->GetAsyncWorkCache().Recycle(work);
+}
+
+void NativeAsyncWork::InitTaskName(const char* asyncResourceName)
+{
+    taskName_ = engine_->GetAsyncWorkCache().InternName(asyncResourceName);
+    if (taskName_ == nullptr) {
+        ownedTaskName_ = asyncResourceName;
+        taskName_ = &ownedTaskName_;
+    }
+}
+
 bool NativeAsyncWork::Queue(NativeEngine* engine)
 {
     VALID_ENGINE_CHECK(engine, engine_, engineId_);
+    ArmCancellation();
 
     uv_loop_t* loop = nullptr;
     if (engine_->IsMainEnvContext()) {
@@ -109,7 +169,7 @@ bool NativeAsyncWork::Queue(NativeEngine* engine)
     HiTraceId taskId = taskTraceId_;
     HiTraceChain::Tracepoint(HITRACE_TP_CS, taskId, "%s", TRACE_POINT_QUEUE.c_str());
 #endif
-    int status = uv_queue_work_internal(loop, &work_, AsyncWorkCallback, AsyncAfterWorkCallback, taskName_.c_str());
+    int status = uv_queue_work_internal(loop, &work_, AsyncWorkCallback, AsyncAfterWorkCallback, taskName_->c_str());
 #ifdef ENABLE_HITRACE
     HiTraceChain::Tracepoint(HITRACE_TP_CR, taskId, "%s", TRACE_POINT_QUEUE.c_str());
     FinishTrace(HITRACE_TAG_ACE);
@@ -119,13 +179,21 @@ bool NativeAsyncWork::Queue(NativeEngine* engine)
         engine_->DecreaseWaitingRequestCounter();
         return false;
     }
+    queuedToUv_ = true;
     HILOG_DEBUG("uv_queue_work succeed");
     return true;
 }
 
 bool NativeAsyncWork::QueueWithQos(NativeEngine* engine, napi_qos_t qos)
+{
+    return QueueWithQosUntil(engine, qos, 0);
+}
+
+bool NativeAsyncWork::QueueWithQosUntil(NativeEngine* engine, napi_qos_t qos, uint64_t deadline)
 {
     VALID_ENGINE_CHECK(engine, engine_, engineId_);
+    // armed with this queueing only, a failed one leaves nothing behind for the next
+    ArmCancellation(deadline);
 
     uv_loop_t* loop = nullptr;
     if (engine_->IsMainEnvContext()) {
@@ -138,6 +206,10 @@ bool NativeAsyncWork::QueueWithQos(NativeEngine* engine, napi_qos_t qos)
         HILOG_ERROR("Get loop failed");
         return false;
     }
+    // sub contexts share the loop of their parent, they stay on the uv pool
+    if (engine_->IsMainEnvContext() && NativeWorkStealingPool::GetInstance().IsRunning() && QueueToPool(qos)) {
+        return true;
+    }
     engine_->IncreaseWaitingRequestCounter();
 #ifdef ENABLE_HITRACE
     StartTrace(HITRACE_TAG_ACE, "Native async work queueWithQos, " + this->GetTraceDescription());
@@ -145,7 +217,7 @@ bool NativeAsyncWork::QueueWithQos(NativeEngine* engine, napi_qos_t qos)
     HiTraceChain::Tracepoint(HITRACE_TP_CS, taskId, "%s", TRACE_POINT_QUEUE_WITH_QOS.c_str());
 #endif
     int status = uv_queue_work_with_qos_internal(loop, &work_, AsyncWorkCallback,
-        AsyncAfterWorkCallback, uv_qos_t(qos), taskName_.c_str());
+        AsyncAfterWorkCallback, uv_qos_t(qos), taskName_->c_str());
 #ifdef ENABLE_HITRACE
     HiTraceChain::Tracepoint(HITRACE_TP_CR, taskId, "%s", TRACE_POINT_QUEUE_WITH_QOS.c_str());
     FinishTrace(HITRACE_TAG_ACE);
@@ -155,13 +227,47 @@ bool NativeAsyncWork::QueueWithQos(NativeEngine* engine, napi_qos_t qos)
         engine_->DecreaseWaitingRequestCounter();
         return false;
     }
+    queuedToUv_ = true;
     HILOG_DEBUG("uv_queue_work_with_qos succeed");
     return true;
 }
 
+bool NativeAsyncWork::QueueToPool(napi_qos_t qos)
+{
+    if (!engine_->AddAsyncWorkPoolRun()) {
+        return false;
+    }
+    if (!engine_->AcquireAsyncWorkPoolChannel()) {
+        HILOG_WARN("async work pool channel is unavailable, fall back to uv pool");
+        engine_->FinishAsyncWorkPoolRun();
+        return false;
+    }
+    engine_->IncreaseWaitingRequestCounter();
+#ifdef ENABLE_HITRACE
+    StartTrace(HITRACE_TAG_ACE, "Native async work queueToPool, " + this->GetTraceDescription());
+    HiTraceId taskId = taskTraceId_;
+    HiTraceChain::Tracepoint(HITRACE_TP_CS, taskId, "%s", TRACE_POINT_QUEUE_TO_POOL.c_str());
+#endif
+    bool submitted = NativeWorkStealingPool::GetInstance().Submit({ PoolWorkCallback, this }, qos);
+#ifdef ENABLE_HITRACE
+    HiTraceChain::Tracepoint(HITRACE_TP_CR, taskId, "%s", TRACE_POINT_QUEUE_TO_POOL.c_str());
+    FinishTrace(HITRACE_TAG_ACE);
+#endif
+    if (!submitted) {
+        HILOG_WARN("work stealing pool rejected the work, fall back to uv pool");
+        engine_->DecreaseWaitingRequestCounter();
+        engine_->ReleaseAsyncWorkPoolChannel();
+        engine_->FinishAsyncWorkPoolRun();
+        return false;
+    }
+    HILOG_DEBUG("queue to work stealing pool succeed");
+    return true;
+}
+
 bool NativeAsyncWork::QueueOrdered(NativeEngine* engine, napi_qos_t qos, uintptr_t queueId)
 {
     VALID_ENGINE_CHECK(engine, engine_, engineId_);
+    ArmCancellation();
 
     uv_loop_t* loop = nullptr;
     if (engine_->IsMainEnvContext()) {
@@ -180,33 +286,78 @@ bool NativeAsyncWork::QueueOrdered(NativeEngine* engine, napi_qos_t qos, uintptr
     HiTraceId taskId = taskTraceId_;
     HiTraceChain::Tracepoint(HITRACE_TP_CS, taskId, "%s", TRACE_POINT_QUEUE_ORDERED.c_str());
 #endif
-    int status = uv_queue_work_ordered(loop, &work_, AsyncWorkCallback, AsyncAfterWorkCallback,
-        uv_qos_t(qos), queueId);
+    // the executors live with the engine owning the loop, sub contexts share the queues of their parent
+    NativeEngine* loopEngine = engine_->IsMainEnvContext() ? engine_ : engine_->GetParent();
+    SerialEnqueueResult result = loopEngine->GetSerialExecutors().Enqueue(loop, queueId, qos, this);
 #ifdef ENABLE_HITRACE
     HiTraceChain::Tracepoint(HITRACE_TP_CR, taskId, "%s", TRACE_POINT_QUEUE_ORDERED.c_str());
     FinishTrace(HITRACE_TAG_ACE);
 #endif
-    if (status != 0) {
-        HILOG_ERROR("uv_queue_work_ordered failed");
+    if (result != SerialEnqueueResult::QUEUED) {
+        HILOG_ERROR("queue ordered work failed, %{public}s",
+                    result == SerialEnqueueResult::BACKLOG_FULL ? "backlog is full" : "drain not queued");
         engine_->DecreaseWaitingRequestCounter();
         return false;
     }
-    HILOG_DEBUG("uv_queue_work_ordered succeed");
+    HILOG_DEBUG("queue ordered work succeed");
     return true;
 }
 
+bool NativeAsyncWork::QueueWithDeadline(NativeEngine* engine, napi_qos_t qos, uint64_t timeoutMs)
+{
+    uint64_t now = GetSteadyTimeNs();
+    // saturated, a timeout too long for the clock never expires
+    uint64_t maxTimeoutMs = (std::numeric_limits<uint64_t>::max() - now) / NS_PER_MS;
+    uint64_t deadline = timeoutMs > maxTimeoutMs ? std::numeric_limits<uint64_t>::max() : now + timeoutMs * NS_PER_MS;
+    return QueueWithQosUntil(engine, qos, deadline);
+}
+
 bool NativeAsyncWork::Cancel(NativeEngine* engine)
 {
     VALID_ENGINE_CHECK(engine, engine_, engineId_);
 
-    int status = uv_cancel((uv_req_t*)&work_);
-    if (status != 0) {
-        HILOG_ERROR("uv_cancel failed");
+    // a running execute callback observes the request through napi_is_async_work_cancelled
+    cancelRequested_.store(true, std::memory_order_release);
+    RunState expected = RunState::QUEUED;
+    if (!runState_.compare_exchange_strong(expected, RunState::CANCELLED, std::memory_order_acq_rel)) {
+        HILOG_ERROR("cancel async work failed, it has already started");
         return false;
     }
+    // a worker that took the request already sees the claim and skips it, so a failed uv_cancel is fine
+    if (queuedToUv_) {
+        uv_cancel((uv_req_t*)&work_);
+    }
     return true;
 }
 
+bool NativeAsyncWork::IsCancelled() const
+{
+    if (cancelRequested_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    uint64_t deadline = deadline_.load(std::memory_order_relaxed);
+    return deadline != 0 && GetSteadyTimeNs() > deadline;
+}
+
+void NativeAsyncWork::ArmCancellation(uint64_t deadline)
+{
+    deadline_.store(deadline, std::memory_order_relaxed);
+    cancelRequested_.store(false, std::memory_order_relaxed);
+    skipped_ = false;
+    queuedToUv_ = false;
+    runState_.store(RunState::QUEUED, std::memory_order_release);
+}
+
+// Called by the worker, false when the work was cancelled or its deadline passed before it started.
+bool NativeAsyncWork::ClaimRun()
+{
+    uint64_t deadline = deadline_.load(std::memory_order_relaxed);
+    RunState target = (deadline != 0 && GetSteadyTimeNs() > deadline) ? RunState::CANCELLED : RunState::RUNNING;
+    RunState expected = RunState::QUEUED;
+    return runState_.compare_exchange_strong(expected, target, std::memory_order_acq_rel) &&
+           target == RunState::RUNNING;
+}
+
 void NativeAsyncWork::AsyncWorkCallback(uv_work_t* req)
 {
     if (req == nullptr) {
@@ -215,6 +366,11 @@ void NativeAsyncWork::AsyncWorkCallback(uv_work_t* req)
     }
 
     auto that = reinterpret_cast<NativeAsyncWork*>(req->data);
+    if (!that->ClaimRun()) {
+        HILOG_DEBUG("NativeAsyncWork::AsyncWorkCallback drop cancelled or expired work.");
+        that->skipped_ = true;
+        return;
+    }
     HILOG_DEBUG("NativeAsyncWork::AsyncWorkCallback start to execute.");
 
 #ifdef ENABLE_HITRACE
@@ -248,6 +404,9 @@ void NativeAsyncWork::AsyncAfterWorkCallback(uv_work_t* req, int status)
     auto vm = engine->GetEcmaVm();
     panda::LocalScope scope(vm);
     napi_status nstatus = napi_generic_failure;
+    if (that->skipped_) {
+        status = UV_ECANCELED;
+    }
     switch (status) {
         case 0:
             nstatus = napi_ok;
@@ -296,6 +455,52 @@ void NativeAsyncWork::AsyncAfterWorkCallback(uv_work_t* req, int status)
 #endif
 }
 
+NativeSafeAsyncWork* NativeAsyncWork::CreatePoolChannel(NativeEngine* engine)
+{
+    auto channel = new (std::nothrow) NativeSafeAsyncWork(engine, nullptr, nullptr, nullptr, 0, 1,
+                                                          nullptr, nullptr, nullptr, nullptr);
+    if (channel == nullptr) {
+        HILOG_ERROR("failed to create async work pool channel");
+        return nullptr;
+    }
+    if (!channel->Init()) {
+        delete channel;
+        return nullptr;
+    }
+    channel->SetBatchCallJsCallback(PoolCompleteCallback);
+    return channel;
+}
+
+void NativeAsyncWork::PoolWorkCallback(void* data)
+{
+    auto that = reinterpret_cast<NativeAsyncWork*>(data);
+    // Don't use that after posting, the complete callback may delete it. The engine is kept until
+    // FinishAsyncWorkPoolRun, the pool outlives every engine.
+    NativeEngine* engine = that->engine_;
+    if (!engine->IsAsyncWorkPoolClosing()) {
+        AsyncWorkCallback(&that->work_);
+        if (!engine->PostAsyncWorkPoolCompletion(that)) {
+            HILOG_ERROR("post async work completion failed, task description: %{public}s",
+                        that->GetTraceDescription().c_str());
+        }
+    }
+    engine->FinishAsyncWorkPoolRun();
+}
+
+void NativeAsyncWork::PoolCompleteCallback(NativeEngine* engine, napi_value jsCallback, void* context, void** data,
+                                           size_t count)
+{
+    // the channel is closed together with the engine, the loop will not run these completions any more
+    if (engine == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        auto that = reinterpret_cast<NativeAsyncWork*>(data[i]);
+        engine->ReleaseAsyncWorkPoolChannel();
+        AsyncAfterWorkCallback(&that->work_, 0);
+    }
+}
+
 std::string NativeAsyncWork::GetTraceDescription()
 {
     return traceDescription_;
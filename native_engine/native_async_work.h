@@ -21,6 +21,7 @@
 #ifdef ENABLE_HITRACE
 #include "hitrace/trace.h"
 #endif
+#include <atomic>
 #include <mutex>
 #include <queue>
 #include <uv.h>
@@ -46,6 +47,8 @@ class HiTraceId;
 } // namespace OHOS
 #endif
 
+class NativeSafeAsyncWork;
+
 class NativeAsyncWork {
 public:
     NativeAsyncWork(NativeEngine* engine,
@@ -53,12 +56,30 @@ public:
                     NativeAsyncCompleteCallback complete,
                     const std::string &asyncResourceName,
                     void* data);
+    NativeAsyncWork(NativeEngine* engine,
+                    NativeAsyncExecuteCallback execute,
+                    NativeAsyncCompleteCallback complete,
+                    const char* asyncResourceName,
+                    void* data);
+
+    // Create the work in storage recycled by the engine, release it with Destroy.
+    static NativeAsyncWork* Create(NativeEngine* engine,
+                                   NativeAsyncExecuteCallback execute,
+                                   NativeAsyncCompleteCallback complete,
+                                   const char* asyncResourceName,
+                                   void* data);
+    // Works not made by Create are deleted.
+    static void Destroy(NativeEngine* engine, NativeAsyncWork* work);
 
     virtual ~NativeAsyncWork();
     virtual bool Queue(NativeEngine* engine);
     virtual bool QueueWithQos(NativeEngine* engine, napi_qos_t qos);
     virtual bool QueueOrdered(NativeEngine* engine, napi_qos_t qos, uintptr_t queueId);
+    // Same as QueueWithQos, the work is dropped with napi_cancelled if it has not started |timeoutMs| from now.
+    virtual bool QueueWithDeadline(NativeEngine* engine, napi_qos_t qos, uint64_t timeoutMs);
     virtual bool Cancel(NativeEngine* engine);
+    // Thread safe, true once the work was cancelled or its deadline passed.
+    bool IsCancelled() const;
     virtual std::string GetTraceDescription();
     template<typename Inner, typename Outer>
     static Outer* DereferenceOf(const Inner Outer::*field, const Inner* pointer)
@@ -72,12 +93,34 @@ public:
     }
     virtual std::string GetTaskName() const
     {
-        return taskName_;
+        return *taskName_;
     }
 
+    // Threadsafe function that carries works finished on the work stealing pool back to the loop of |engine|.
+    static NativeSafeAsyncWork* CreatePoolChannel(NativeEngine* engine);
+
 private:
+    friend class NativeSerialExecutorRegistry;
+
+    // a queued work is claimed exactly once, either by the worker that runs it or by Cancel
+    enum class RunState : uint8_t {
+        IDLE,
+        QUEUED,
+        RUNNING,
+        CANCELLED,
+    };
+
     static void AsyncWorkCallback(uv_work_t* req);
     static void AsyncAfterWorkCallback(uv_work_t* req, int status);
+    static void PoolWorkCallback(void* data);
+    static void PoolCompleteCallback(NativeEngine* engine, napi_value jsCallback, void* context, void** data,
+                                     size_t count);
+    bool QueueToPool(napi_qos_t qos);
+    // |deadline| is in steady clock nanoseconds, 0 for none.
+    void ArmCancellation(uint64_t deadline = 0);
+    bool QueueWithQosUntil(NativeEngine* engine, napi_qos_t qos, uint64_t deadline);
+    bool ClaimRun();
+    void InitTaskName(const char* asyncResourceName);
 
     uv_work_t work_;
     NativeEngine* engine_;
@@ -85,10 +128,19 @@ private:
     NativeAsyncExecuteCallback execute_;
     NativeAsyncCompleteCallback complete_;
     void* data_;
-    std::mutex workAsyncMutex_;
-    std::queue<NativeAsyncWorkDataPointer> asyncWorkRecvData_;
     std::string traceDescription_;
-    std::string taskName_;
+    // interned by the engine, points to ownedTaskName_ when the intern table is full
+    const std::string* taskName_ {nullptr};
+    std::string ownedTaskName_;
+    bool pooled_ {false};
+    // steady clock nanoseconds, 0 when the work has no deadline
+    std::atomic<uint64_t> deadline_ {0};
+    std::atomic<bool> cancelRequested_ {false};
+    std::atomic<RunState> runState_ {RunState::IDLE};
+    // set by the worker when it dropped the work, read by the loop after the work completed
+    bool skipped_ {false};
+    // work_ was handed to the uv pool, only then uv_cancel applies
+    bool queuedToUv_ {false};
 #ifdef ENABLE_CONTAINER_SCOPE
     int32_t containerScopeId_;
 #endif
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_async_work_batch.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "native_api_internal.h"
+#include "native_work_stealing_pool.h"
+
+NativeAsyncWorkBatch::NativeAsyncWorkBatch(NativeEngine* engine,
+                                           NativeAsyncExecuteCallback execute,
+                                           void* const* data,
+                                           size_t count,
+                                           NativeAsyncCompleteCallback complete,
+                                           void* completeData)
+    : engine_(engine), execute_(execute), complete_(complete), completeData_(completeData), items_(data, data + count)
+{
+}
+
+NativeAsyncWorkBatch::~NativeAsyncWorkBatch()
+{
+    for (auto lane : lanes_) {
+        NativeAsyncWork::Destroy(engine_, lane);
+    }
+    lanes_.clear();
+}
+
+size_t NativeAsyncWorkBatch::GetLaneCount(size_t count)
+{
+    size_t threads = NativeWorkStealingPool::GetInstance().GetThreadCount();
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(1, std::min(count, threads));
+}
+
+bool NativeAsyncWorkBatch::Queue(NativeEngine* engine,
+                                 const char* asyncResourceName,
+                                 NativeAsyncExecuteCallback execute,
+                                 void* const* data,
+                                 size_t count,
+                                 NativeAsyncCompleteCallback complete,
+                                 void* completeData,
+                                 napi_qos_t qos)
+{
+    auto batch = new (std::nothrow) NativeAsyncWorkBatch(engine, execute, data, count, complete, completeData);
+    if (batch == nullptr) {
+        HILOG_ERROR("failed to create async work batch");
+        return false;
+    }
+    size_t laneCount = GetLaneCount(count);
+    batch->lanes_.reserve(laneCount);
+    for (size_t i = 0; i < laneCount; i++) {
+        auto lane = NativeAsyncWork::Create(engine, LaneExecute, LaneComplete, asyncResourceName, batch);
+        if (lane == nullptr) {
+            break;
+        }
+        batch->lanes_.push_back(lane);
+    }
+    // lanes complete on this thread, none of them can finish before the loop runs again
+    for (auto lane : batch->lanes_) {
+        if (lane->QueueWithQos(engine, qos)) {
+            batch->pendingLanes_++;
+        }
+    }
+    if (batch->pendingLanes_ == 0) {
+        HILOG_ERROR("no lane of the async work batch was queued");
+        delete batch;
+        return false;
+    }
+    return true;
+}
+
+void NativeAsyncWorkBatch::LaneExecute(NativeEngine* engine, void* data)
+{
+    auto batch = reinterpret_cast<NativeAsyncWorkBatch*>(data);
+    size_t count = batch->items_.size();
+    while (true) {
+        size_t index = batch->next_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= count) {
+            break;
+        }
+        batch->execute_(engine, batch->items_[index]);
+    }
+}
+
+void NativeAsyncWorkBatch::LaneComplete(NativeEngine* engine, int status, void* data)
+{
+    auto batch = reinterpret_cast<NativeAsyncWorkBatch*>(data);
+    if (status != napi_ok && batch->status_ == napi_ok) {
+        batch->status_ = status;
+    }
+    if (--batch->pendingLanes_ > 0) {
+        return;
+    }
+    // a cancelled lane leaves its share to the others, items are only lost if every lane was cancelled
+    int result = batch->next_.load() >= batch->items_.size() ? napi_ok : batch->status_;
+    auto complete = batch->complete_;
+    auto completeData = batch->completeData_;
+    delete batch;
+    complete(engine, result, completeData);
+}
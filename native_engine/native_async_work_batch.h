@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_WORK_BATCH_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_WORK_BATCH_H
+
+#include <atomic>
+#include <vector>
+
+#include "interfaces/kits/napi/common.h"
+#include "native_value.h"
+
+class NativeAsyncWork;
+
+// Runs one execute callback over a set of data pointers and completes once.
+// The items are spread over a few lane works, each lane keeps taking the next unclaimed item until none is left,
+// so uneven items balance themselves. The loop thread only sees one completion per lane and the complete
+// callback fires after the last lane.
+class NativeAsyncWorkBatch {
+public:
+    static bool Queue(NativeEngine* engine,
+                      const char* asyncResourceName,
+                      NativeAsyncExecuteCallback execute,
+                      void* const* data,
+                      size_t count,
+                      NativeAsyncCompleteCallback complete,
+                      void* completeData,
+                      napi_qos_t qos);
+
+private:
+    NativeAsyncWorkBatch(NativeEngine* engine,
+                         NativeAsyncExecuteCallback execute,
+                         void* const* data,
+                         size_t count,
+                         NativeAsyncCompleteCallback complete,
+                         void* completeData);
+    ~NativeAsyncWorkBatch();
+
+    static void LaneExecute(NativeEngine* engine, void* data);
+    static void LaneComplete(NativeEngine* engine, int status, void* data);
+    static size_t GetLaneCount(size_t count);
+
+    NativeEngine* engine_;
+    NativeAsyncExecuteCallback execute_;
+    NativeAsyncCompleteCallback complete_;
+    void* completeData_;
+    std::vector<void*> items_;
+    std::atomic<size_t> next_ {0};
+    std::vector<NativeAsyncWork*> lanes_;
+    // loop thread only
+    size_t pendingLanes_ {0};
+    int status_ {0};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_WORK_BATCH_H */
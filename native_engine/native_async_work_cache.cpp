@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_async_work_cache.h"
+
+#include <new>
+
+NativeAsyncWorkCache::~NativeAsyncWorkCache()
+{
+    for (void* block : freeBlocks_) {
+        ::operator delete(block);
+    }
+    freeBlocks_.clear();
+}
+
+void* NativeAsyncWorkCache::Allocate()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!freeBlocks_.empty()) {
+            void* block = freeBlocks_.back();
+            freeBlocks_.pop_back();
+            hits_++;
+            return block;
+        }
+        misses_++;
+    }
+    return ::operator new(blockSize_, std::nothrow);
+}
+
+void NativeAsyncWorkCache::Recycle(void* block)
+{
+    if (block == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (freeBlocks_.capacity() == 0) {
+            freeBlocks_.reserve(MAX_CACHED_BLOCKS);
+        }
+        if (freeBlocks_.size() < MAX_CACHED_BLOCKS) {
+            freeBlocks_.push_back(block);
+            return;
+        }
+    }
+    ::operator delete(block);
+}
+
+const std::string* NativeAsyncWorkCache::InternName(std::string_view name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = names_.find(name);
+    if (iter != names_.end()) {
+        return iter->second.get();
+    }
+    if (names_.size() >= MAX_INTERNED_NAMES) {
+        return nullptr;
+    }
+    auto owned = std::make_unique<std::string>(name);
+    const std::string* result = owned.get();
+    names_.emplace(std::string_view(*result), std::move(owned));
+    return result;
+}
+
+void NativeAsyncWorkCache::GetStats(NativeAsyncWorkCacheStats& stats)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.cachedBlocks = freeBlocks_.size();
+    stats.internedNames = names_.size();
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_WORK_CACHE_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_WORK_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct NativeAsyncWorkCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t cachedBlocks = 0;
+    size_t internedNames = 0;
+};
+
+// Per-engine freelist of NativeAsyncWork storage and table of interned resource names.
+// All blocks have the size of a NativeAsyncWork and come from ::operator new, so a block released by one engine
+// may serve any other. Blocks beyond MAX_CACHED_BLOCKS go back to the heap.
+class NativeAsyncWorkCache {
+public:
+    explicit NativeAsyncWorkCache(size_t blockSize) : blockSize_(blockSize) {}
+    ~NativeAsyncWorkCache();
+
+    NativeAsyncWorkCache(const NativeAsyncWorkCache&) = delete;
+    NativeAsyncWorkCache& operator=(const NativeAsyncWorkCache&) = delete;
+
+    void* Allocate();
+    void Recycle(void* block);
+
+    // Returns nullptr once the table is full, callers keep their own copy of the name then.
+    const std::string* InternName(std::string_view name);
+
+    void GetStats(NativeAsyncWorkCacheStats& stats);
+
+private:
+    static constexpr size_t MAX_CACHED_BLOCKS = 256;
+    static constexpr size_t MAX_INTERNED_NAMES = 1024;
+
+    const size_t blockSize_;
+    std::mutex mutex_;
+    std::vector<void*> freeBlocks_;
+    // keys view the owned strings, lookups with a string_view don't allocate
+    std::unordered_map<std::string_view, std::unique_ptr<std::string>> names_;
+    uint64_t hits_ {0};
+    uint64_t misses_ {0};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ASYNC_WORK_CACHE_H */
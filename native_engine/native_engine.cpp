@@ -157,8 +157,11 @@ void NativeEngine::Init()
 void NativeEngine::Deinit()
 {
     HILOG_INFO("NativeEngine");
+    // the works and the engine must outlive the pool workers still running them
+    WaitAsyncWorkPoolRuns();
     if (loop_ != nullptr) {
         NativeEvent::DestoryDefaultFunction(true, defaultFunc_, eventMutex_);
+        DestroyAsyncWorkPoolChannel();
         uv_sem_destroy(&uvSem_);
         uv_close((uv_handle_t*)&uvAsync_, nullptr);
     }
@@ -244,6 +247,8 @@ bool NativeEngine::ReinitUVLoop()
     if (defaultFunc_ != nullptr) {
         NativeEvent::DestoryDefaultFunction(true, defaultFunc_, eventMutex_);
     }
+    DrainAsyncWorkPoolRuns();
+    DestroyAsyncWorkPoolChannel();
 
     if (loop_ != nullptr) {
         auto const ensureClosing = [](uv_handle_t *handle, void *arg) {
@@ -281,6 +286,116 @@ bool NativeEngine::ReinitUVLoop()
     return true;
 }
 
+bool NativeEngine::AcquireAsyncWorkPoolChannel()
+{
+    std::unique_lock<std::shared_mutex> lock(asyncWorkPoolMutex_);
+    if (asyncWorkPoolChannel_ == nullptr) {
+        asyncWorkPoolChannel_ = NativeAsyncWork::CreatePoolChannel(this);
+        if (asyncWorkPoolChannel_ == nullptr) {
+            return false;
+        }
+        // like the uv pool, only works in flight keep the loop alive
+        asyncWorkPoolChannel_->Unref();
+    }
+    if (asyncWorkPoolInflight_++ == 0) {
+        asyncWorkPoolChannel_->Ref();
+    }
+    return true;
+}
+
+void NativeEngine::ReleaseAsyncWorkPoolChannel()
+{
+    std::unique_lock<std::shared_mutex> lock(asyncWorkPoolMutex_);
+    if (asyncWorkPoolInflight_ == 0) {
+        return;
+    }
+    if (--asyncWorkPoolInflight_ == 0 && asyncWorkPoolChannel_ != nullptr) {
+        asyncWorkPoolChannel_->Unref();
+    }
+}
+
+bool NativeEngine::PostAsyncWorkPoolCompletion(NativeAsyncWork* work)
+{
+    std::shared_lock<std::shared_mutex> lock(asyncWorkPoolMutex_);
+    if (asyncWorkPoolChannel_ == nullptr) {
+        return false;
+    }
+    return asyncWorkPoolChannel_->Send(work, NATIVE_TSFUNC_NONBLOCKING) == SafeAsyncCode::SAFE_ASYNC_OK;
+}
+
+bool NativeEngine::AddAsyncWorkPoolRun()
+{
+    std::lock_guard<std::mutex> lock(asyncWorkPoolRunsMutex_);
+    if (IsAsyncWorkPoolClosing()) {
+        return false;
+    }
+    if (asyncWorkPoolRuns_++ == 0) {
+        asyncWorkPoolRunsPid_ = uv_os_getpid();
+    }
+    return true;
+}
+
+void NativeEngine::FinishAsyncWorkPoolRun()
+{
+    // notified under the lock, the engine may be destroyed as soon as it is released
+    std::lock_guard<std::mutex> lock(asyncWorkPoolRunsMutex_);
+    if (--asyncWorkPoolRuns_ == 0) {
+        asyncWorkPoolRunsCond_.notify_all();
+    }
+}
+
+void NativeEngine::WaitAsyncWorkPoolRuns()
+{
+    asyncWorkPoolClosing_.store(true, std::memory_order_release);
+    std::unique_lock<std::mutex> lock(asyncWorkPoolRunsMutex_);
+    asyncWorkPoolRunsCond_.wait(lock, [this] { return asyncWorkPoolRuns_ == 0; });
+}
+
+void NativeEngine::DrainAsyncWorkPoolRuns()
+{
+    size_t lost = 0;
+    {
+        std::unique_lock<std::mutex> lock(asyncWorkPoolRunsMutex_);
+        if (asyncWorkPoolRuns_ > 0 && asyncWorkPoolRunsPid_ != uv_os_getpid()) {
+            // counted by the parent before a fork, nothing in this process runs them
+            lost = asyncWorkPoolRuns_;
+            asyncWorkPoolRuns_ = 0;
+        }
+        asyncWorkPoolRunsCond_.wait(lock, [this] { return asyncWorkPoolRuns_ == 0; });
+    }
+    if (lost > 0) {
+        HILOG_WARN("%{public}zu async works on the pool were lost with the fork", lost);
+        for (; lost > 0; lost--) {
+            DecreaseWaitingRequestCounter();
+        }
+        return;
+    }
+    // the channel holds the loop while completions are pending, each of them releases it once
+    while (loop_ != nullptr) {
+        {
+            std::shared_lock<std::shared_mutex> lock(asyncWorkPoolMutex_);
+            if (asyncWorkPoolInflight_ == 0) {
+                break;
+            }
+        }
+        uv_run(loop_, UV_RUN_ONCE);
+    }
+}
+
+void NativeEngine::DestroyAsyncWorkPoolChannel()
+{
+    NativeSafeAsyncWork* channel = nullptr;
+    {
+        std::unique_lock<std::shared_mutex> lock(asyncWorkPoolMutex_);
+        channel = asyncWorkPoolChannel_;
+        asyncWorkPoolChannel_ = nullptr;
+        asyncWorkPoolInflight_ = 0;
+    }
+    if (channel != nullptr) {
+        channel->Release(NATIVE_TSFUNC_ABORT);
+    }
+}
+
 void NativeEngine::Loop(LoopMode mode, bool needSync)
 {
     if (loop_ == nullptr) {
@@ -16,9 +16,11 @@
 #ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ENGINE_H
 #define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_ENGINE_H
 
+#include <condition_variable>
 #include <cstdint>
 #include <functional>
 #include <list>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -32,9 +34,11 @@
 #include "interfaces/inner_api/napi/native_node_hybrid_api.h"
 #include "module_manager/native_module_manager.h"
 #include "native_engine/native_async_work.h"
+#include "native_engine/native_async_work_cache.h"
 #include "native_engine/native_deferred.h"
 #include "native_engine/native_reference.h"
 #include "native_engine/native_safe_async_work.h"
+#include "native_engine/native_serial_executor.h"
 #include "native_engine/native_event.h"
 #include "native_engine/native_value.h"
 #include "native_property.h"
@@ -255,7 +259,11 @@ public:
         size_t nativeBindingSize = 0) = 0;
 
     virtual NativeReference* CreateAsyncReference(napi_value value, uint32_t initialRefcount,
-        bool flag = false, NapiNativeFinalize callback = nullptr, void* data = nullptr, void* hint = nullptr) = 0;
+        bool flag = false, NapiNativeFinalize callback = nullptr, void* data = nullptr, void* hint = nullptr,
+        size_t nativeBindingSize = 0) = 0;
+    virtual NativeReference* CreateConcurrentReference(napi_value value, uint32_t initialRefcount,
+        bool flag = false, NapiNativeFinalize callback = nullptr, void* data = nullptr, void* hint = nullptr,
+        size_t nativeBindingSize = 0) = 0;
 
     virtual NativeAsyncWork* CreateAsyncWork(napi_value asyncResource,
                                              napi_value asyncResourceName,
@@ -749,6 +757,21 @@ private:
 #endif
     mutable std::shared_mutex eventMutex_;
     napi_threadsafe_function defaultFunc_ = nullptr;
+    // completion channel of the work stealing pool, created by the first work queued to the pool
+    std::shared_mutex asyncWorkPoolMutex_;
+    NativeSafeAsyncWork* asyncWorkPoolChannel_ = nullptr;
+    size_t asyncWorkPoolInflight_ = 0;
+    // works submitted to the pool that may still touch the engine, teardown waits for them
+    std::mutex asyncWorkPoolRunsMutex_;
+    std::condition_variable asyncWorkPoolRunsCond_;
+    size_t asyncWorkPoolRuns_ = 0;
+    // process that counted the runs, the workers do not survive a fork
+    uv_pid_t asyncWorkPoolRunsPid_ = 0;
+    std::atomic<bool> asyncWorkPoolClosing_ { false };
+    // recycled storage and interned resource names of napi_create_async_work
+    NativeAsyncWorkCache asyncWorkCache_ { sizeof(NativeAsyncWork) };
+    // serial executors of napi_queue_async_work_with_queue, loop thread only
+    NativeSerialExecutorRegistry serialExecutors_;
     // Record the instance of FA model to find the correct ArkUI instance while posting cross-thread task
     int32_t instanceId_ = -1;
     PostTask postTask_ = nullptr;
@@ -788,6 +811,37 @@ public:
         return defaultFunc_;
     }
 
+    // Keep the pool channel alive and the loop referenced for one more work, JS thread only.
+    bool AcquireAsyncWorkPoolChannel();
+    // Counterpart of AcquireAsyncWorkPoolChannel once the work completed, JS thread only.
+    void ReleaseAsyncWorkPoolChannel();
+    // Hand a work executed on the pool back to the loop, thread safe.
+    bool PostAsyncWorkPoolCompletion(NativeAsyncWork* work);
+    void DestroyAsyncWorkPoolChannel();
+    // Counts a work submitted to the pool until its worker finished with it, the engine stays alive in between.
+    // Returns false once the engine is being destroyed.
+    bool AddAsyncWorkPoolRun();
+    void FinishAsyncWorkPoolRun();
+    // Works that did not start before teardown are not executed anymore.
+    bool IsAsyncWorkPoolClosing() const
+    {
+        return asyncWorkPoolClosing_.load(std::memory_order_acquire);
+    }
+    // Called on teardown, waits until no pool worker touches the engine or its works anymore.
+    void WaitAsyncWorkPoolRuns();
+    // Called before the loop is replaced, waits for the pool works and runs their completions on the old loop.
+    void DrainAsyncWorkPoolRuns();
+
+    inline NativeAsyncWorkCache& GetAsyncWorkCache()
+    {
+        return asyncWorkCache_;
+    }
+
+    inline NativeSerialExecutorRegistry& GetSerialExecutors()
+    {
+        return serialExecutors_;
+    }
+
     inline static bool IsAliveLocked(NativeEngine* env)
     {
         return g_alivedEngine_.find(env) != g_alivedEngine_.end();
@@ -178,24 +178,39 @@ NAPI_EXTERN napi_status napi_cancel_event(napi_env env, uint64_t handleId, const
     return safeAsyncWork->CancelEvent(((name == nullptr) ? DEFAULT_NAME: name), handleId);
 }
 
+NAPI_EXTERN napi_status napi_get_event_wakeup_stats(napi_env env, uint64_t* sent, uint64_t* elided)
+{
+    CHECK_ENV(env);
+    if (sent == nullptr || elided == nullptr) {
+        HILOG_ERROR("invalid sent or elided");
+        return napi_status::napi_invalid_arg;
+    }
+    NativeEngine *eng = reinterpret_cast<NativeEngine *>(env);
+
+    NativeEngine::GetAliveEngineMutex().lock();
+    if (!NativeEngine::IsAliveLocked(eng)) {
+        NativeEngine::GetAliveEngineMutex().unlock();
+        HILOG_ERROR("call NativeEngine not alive");
+        return napi_status::napi_closing;
+    }
+    std::shared_lock<std::shared_mutex> readLock(eng->GetEventMutex());
+    NativeEngine::GetAliveEngineMutex().unlock();
+
+    if (!eng->GetDefaultFunc()) {
+        HILOG_ERROR("default function is nullptr!");
+        return napi_status::napi_generic_failure;
+    }
+    auto safeAsyncWork = reinterpret_cast<NativeEvent*>(eng->GetDefaultFunc());
+    safeAsyncWork->GetWakeupCounters(*sent, *elided);
+    return napi_status::napi_ok;
+}
+
 // static method
 static void ThreadSafeCallback(napi_env env, napi_value jsCallback, void* context, void* data)
 {
-    if (data != nullptr) {
-        CallbackWrapper *cbw = static_cast<CallbackWrapper *>(data);
-        uint64_t expected = cbw->handleId.load(std::memory_order_acquire);
-        if (expected != INVALID_EVENT_ID &&
-            cbw->handleId.compare_exchange_strong(expected, INVALID_EVENT_ID,
-                                                  std::memory_order_acq_rel, std::memory_order_relaxed)) {
-#ifdef ENABLE_HITRACE
-            StartTrace(HITRACE_TAG_ACE, "ThreadSafeCallback excute");
-#endif
-            cbw->cb();
-#ifdef ENABLE_HITRACE
-            FinishTrace(HITRACE_TAG_ACE);
-#endif
-        }
-        delete cbw;
+    NativeEvent* event = static_cast<NativeEvent*>(context);
+    if (event != nullptr) {
+        event->RunNextEvent();
     }
 }
 
@@ -258,6 +273,20 @@ NativeEvent::NativeEvent(NativeEngine* engine,
         func, asyncResource, asyncResourceName, maxQueueSize, threadCount,
         finalizeData, finalizeCallback, context, callJsCallback)
 {
+    // tokens in queue_ carry no data, the callback finds the lanes through the context
+    context_ = this;
+}
+
+NativeEvent::~NativeEvent()
+{
+    std::lock_guard<std::mutex> lock(laneMutex_);
+    for (auto &lane : lanes_) {
+        for (CallbackWrapper* cbw : lane) {
+            delete cbw;
+        }
+        lane.clear();
+    }
+    eventIndex_.clear();
 }
 
 bool NativeEvent::Init()
@@ -288,7 +317,7 @@ napi_status NativeEvent::SendCancelableEvent(const std::function<void(void*)> &c
         if (sentEventRes != napi_status::napi_invalid_arg) {
             return sentEventRes;
         }
-        return SendEventByUv(task, eventId, name, handleId);
+        return SendEventByUv(task, eventId, priority, name, handleId);
     }
 #endif
     std::function<void()> task = [eng = engine_, callback, data, eventId]() {
@@ -304,7 +333,7 @@ napi_status NativeEvent::SendCancelableEvent(const std::function<void(void*)> &c
         return sentEventOut;
     }
 
-    return SendEventByUv(task, eventId, name, handleId);
+    return SendEventByUv(task, eventId, priority, name, handleId);
 }
 
 napi_status NativeEvent::SendEventByEventHandler(const std::function<void()> &task, uint64_t eventId,
@@ -339,7 +368,7 @@ napi_status NativeEvent::SendEventByEventHandler(const std::function<void()> &ta
     return napi_status::napi_invalid_arg;
 }
 
-napi_status NativeEvent::SendEventByUv(const std::function<void()> &task, uint64_t eventId,
+napi_status NativeEvent::SendEventByUv(const std::function<void()> &task, uint64_t eventId, int32_t priority,
                                        const char* name, uint64_t* handleId)
 {
     CallbackWrapper* cbw = new (std::nothrow) CallbackWrapper();
@@ -354,7 +383,20 @@ napi_status NativeEvent::SendEventByUv(const std::function<void()> &task, uint64
     };
     cbw->cb = incCountTask;
     cbw->handleId.store(eventId, std::memory_order_release);
-    napi_status status = SendConvertStatus2NapiStatus(reinterpret_cast<void *>(cbw), NATIVE_TSFUNC_NONBLOCKING);
+    size_t lane = (priority < 0 || static_cast<size_t>(priority) >= EVENT_LANE_COUNT) ?
+        EVENT_LANE_COUNT - 1 : static_cast<size_t>(priority);
+    napi_status status = napi_status::napi_ok;
+    {
+        // the token is sent under the lane lock, so no token can take the event before a failed send removes it
+        // again and every queued event keeps exactly one token. A nonblocking send never waits for the loop.
+        std::lock_guard<std::mutex> lock(laneMutex_);
+        lanes_[lane].push_back(cbw);
+        eventIndex_.emplace(eventId, cbw);
+        status = SendConvertStatus2NapiStatus(nullptr, NATIVE_TSFUNC_NONBLOCKING);
+        if (status != napi_status::napi_ok) {
+            RemoveEventLocked(cbw, eventId);
+        }
+    }
     *handleId = eventId;
     std::string res = (status == napi_status::napi_ok? "ok": "fail");
     auto uvt = TraceLogClass(
@@ -368,6 +410,78 @@ napi_status NativeEvent::SendEventByUv(const std::function<void()> &task, uint64
     return status;
 }
 
+void NativeEvent::RemoveEventLocked(CallbackWrapper* cbw, uint64_t eventId)
+{
+    for (auto &lane : lanes_) {
+        for (auto iter = lane.rbegin(); iter != lane.rend(); ++iter) {
+            if (*iter == cbw) {
+                lane.erase(std::next(iter).base());
+                eventIndex_.erase(eventId);
+                return;
+            }
+        }
+    }
+}
+
+// Serves the highest non-empty lane, unless a lower lane was bypassed EVENT_LANE_STARVATION_LIMIT times.
+CallbackWrapper* NativeEvent::PopNextEventLocked()
+{
+    size_t picked = EVENT_LANE_COUNT;
+    for (size_t lane = 0; lane < EVENT_LANE_COUNT; lane++) {
+        if (lanes_[lane].empty()) {
+            continue;
+        }
+        if (picked == EVENT_LANE_COUNT) {
+            picked = lane;
+        } else if (laneSkipped_[lane] >= EVENT_LANE_STARVATION_LIMIT) {
+            picked = lane;
+            break;
+        }
+    }
+    if (picked == EVENT_LANE_COUNT) {
+        return nullptr;
+    }
+    for (size_t lane = 0; lane < EVENT_LANE_COUNT; lane++) {
+        if (lane != picked && !lanes_[lane].empty()) {
+            laneSkipped_[lane]++;
+        }
+    }
+    laneSkipped_[picked] = 0;
+
+    CallbackWrapper* cbw = lanes_[picked].front();
+    lanes_[picked].pop_front();
+    uint64_t eventId = cbw->handleId.load(std::memory_order_acquire);
+    if (eventId != INVALID_EVENT_ID) {
+        eventIndex_.erase(eventId);
+    }
+    return cbw;
+}
+
+void NativeEvent::RunNextEvent()
+{
+    CallbackWrapper* cbw = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(laneMutex_);
+        cbw = PopNextEventLocked();
+    }
+    if (cbw == nullptr) {
+        return;
+    }
+    uint64_t expected = cbw->handleId.load(std::memory_order_acquire);
+    if (expected != INVALID_EVENT_ID &&
+        cbw->handleId.compare_exchange_strong(expected, INVALID_EVENT_ID,
+                                              std::memory_order_acq_rel, std::memory_order_relaxed)) {
+#ifdef ENABLE_HITRACE
+        StartTrace(HITRACE_TAG_ACE, "ThreadSafeCallback excute");
+#endif
+        cbw->cb();
+#ifdef ENABLE_HITRACE
+        FinishTrace(HITRACE_TAG_ACE);
+#endif
+    }
+    delete cbw;
+}
+
 napi_status NativeEvent::CancelEvent(const char* name, uint64_t handleId)
 {
     auto tc = TraceLogClass("Cancel Event:" + std::string(name) + "|handleId:" + std::to_string(handleId));
@@ -394,7 +508,6 @@ napi_status NativeEvent::CancelEvent(const char* name, uint64_t handleId)
 
 SafeAsyncCode NativeEvent::UvCancelEvent(uint64_t handleId)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
     if (status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED ||
         status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING) {
         HILOG_WARN("Do not cancel, thread is closed!");
@@ -405,22 +518,20 @@ SafeAsyncCode NativeEvent::UvCancelEvent(uint64_t handleId)
         return SafeAsyncCode::SAFE_ASYNC_FAILED;
     }
 
-    for (const auto &current : queue_) {
-        if (current == nullptr) {
-            continue;
-        }
-        CallbackWrapper* cbw = reinterpret_cast<CallbackWrapper *>(current);
-        if (cbw->handleId.load(std::memory_order_relaxed) != handleId) {
-            continue;
-        }
-        if (cbw->handleId.compare_exchange_strong(handleId, INVALID_EVENT_ID,
-                                                  std::memory_order_acq_rel, std::memory_order_relaxed)) {
-            engine_->DecreaseWaitingRequestCounter();
-            return SafeAsyncCode::SAFE_ASYNC_OK;
-        }
-        HILOG_WARN("UvCancelEvent false %{public}s", std::to_string(handleId).c_str());
+    std::lock_guard<std::mutex> lock(laneMutex_);
+    auto iter = eventIndex_.find(handleId);
+    if (iter == eventIndex_.end()) {
         return SafeAsyncCode::SAFE_ASYNC_FAILED;
     }
+    CallbackWrapper* cbw = iter->second;
+    eventIndex_.erase(iter);
+    // the wrapper stays in its lane and is freed when its token is processed
+    if (cbw->handleId.compare_exchange_strong(handleId, INVALID_EVENT_ID,
+                                              std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        engine_->DecreaseWaitingRequestCounter();
+        return SafeAsyncCode::SAFE_ASYNC_OK;
+    }
+    HILOG_WARN("UvCancelEvent false %{public}s", std::to_string(handleId).c_str());
     return SafeAsyncCode::SAFE_ASYNC_FAILED;
 }
 
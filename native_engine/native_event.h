@@ -16,8 +16,11 @@
 #define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_EVENT_H
 #include <atomic>
 #include <cstdint>
+#include <deque>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include "native_safe_async_work.h"
 
 typedef struct CallbackWrapper_ {
@@ -37,6 +40,7 @@ public:
                 NativeFinalize finalizeCallback,
                 void* context,
                 NativeThreadSafeFunctionCallJs callJsCallback);
+    ~NativeEvent() override;
     bool Init() override;
     virtual napi_status SendCancelableEvent(const std::function<void(void*)> &callback,
                                             void* data,
@@ -50,6 +54,8 @@ public:
                                       std::shared_mutex &eventMutex);
     static void DestoryDefaultFunction(bool release, napi_threadsafe_function &defaultFunc,
                                        std::shared_mutex &eventMutex);
+    // Runs the next event of the uv path, called once per item sent through SendEventByUv.
+    void RunNextEvent();
 protected:
     //unique key for event
     std::atomic<uint64_t> sequence_;
@@ -57,8 +63,21 @@ protected:
     napi_status SendEventByEventHandler(const std::function<void()> &task, uint64_t eventId,
                                         int32_t priority, const char* name, uint64_t* handleId,
                                         int32_t option = 0);
-    napi_status SendEventByUv(const std::function<void()> &task, uint64_t eventId,
+    napi_status SendEventByUv(const std::function<void()> &task, uint64_t eventId, int32_t priority,
                               const char* name, uint64_t* handleId);
     napi_status SendConvertStatus2NapiStatus(void* data, NativeThreadSafeFunctionCallMode mode);
+    CallbackWrapper* PopNextEventLocked();
+    void RemoveEventLocked(CallbackWrapper* cbw, uint64_t eventId);
+
+    // One lane per napi_event_priority, from napi_eprio_vip to napi_eprio_idle.
+    static constexpr size_t EVENT_LANE_COUNT = 5;
+    // A non-empty lane bypassed this many times in a row is served before higher lanes.
+    static constexpr size_t EVENT_LANE_STARVATION_LIMIT = 16;
+
+    // Events of the uv path live in the lanes, queue_ only holds one nullptr token per event.
+    std::mutex laneMutex_;
+    std::deque<CallbackWrapper*> lanes_[EVENT_LANE_COUNT];
+    size_t laneSkipped_[EVENT_LANE_COUNT] {};
+    std::unordered_map<uint64_t, CallbackWrapper*> eventIndex_;
 };
 #endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_EVENT_H */
\ No newline at end of file
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_memory_accounting.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <map>
+#include <sstream>
+
+#if !defined(WINDOWS_PLATFORM)
+#include <dlfcn.h>
+#endif
+
+#include "utils/log.h"
+
+NativeMemoryAccounting::TagEntry* NativeMemoryAccounting::FindTag(uintptr_t tag, bool insert)
+{
+    if (tag == 0) {
+        return &otherTag_;
+    }
+    // Fibonacci hashing, the low bits of a function address are mostly alignment
+    constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+    size_t index = static_cast<size_t>((static_cast<uint64_t>(tag) * multiplier) >> 56) & (MAX_TAGS - 1);
+    for (size_t probe = 0; probe < MAX_TAGS; probe++) {
+        TagEntry& entry = tags_[(index + probe) & (MAX_TAGS - 1)];
+        uintptr_t current = entry.tag.load(std::memory_order_acquire);
+        if (current == tag) {
+            return &entry;
+        }
+        if (current != 0) {
+            continue;
+        }
+        if (!insert) {
+            return nullptr;
+        }
+        if (entry.tag.compare_exchange_strong(current, tag, std::memory_order_acq_rel) || current == tag) {
+            return &entry;
+        }
+    }
+    // the table is full, slots are never freed so the tag was counted here too
+    return &otherTag_;
+}
+
+void NativeMemoryAccounting::UpdateMax(std::atomic<size_t>& target, size_t value)
+{
+    size_t current = target.load(std::memory_order_relaxed);
+    while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        // a failed exchange reloads current
+    }
+}
+
+void NativeMemoryAccounting::AddBinding(uintptr_t tag, size_t bytes)
+{
+    bindingObjects_.fetch_add(1, std::memory_order_relaxed);
+    bindingBytes_.fetch_add(bytes, std::memory_order_relaxed);
+    TagEntry* entry = FindTag(tag, true);
+    entry->objects.fetch_add(1, std::memory_order_relaxed);
+    UpdateMax(entry->peakBytes, entry->bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    UpdateMax(peakBytes_, GetTotalBytes());
+}
+
+void NativeMemoryAccounting::RemoveBinding(uintptr_t tag, size_t bytes)
+{
+    bindingObjects_.fetch_sub(1, std::memory_order_relaxed);
+    bindingBytes_.fetch_sub(bytes, std::memory_order_relaxed);
+    TagEntry* entry = FindTag(tag, false);
+    if (entry == nullptr) {
+        HILOG_ERROR("native binding tag 0x%{public}" PRIxPTR " is not accounted", tag);
+        return;
+    }
+    entry->objects.fetch_sub(1, std::memory_order_relaxed);
+    entry->bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+int64_t NativeMemoryAccounting::AdjustExternal(int64_t changeInBytes)
+{
+    int64_t current = externalBytes_.load(std::memory_order_relaxed);
+    int64_t adjusted = 0;
+    do {
+        adjusted = std::max<int64_t>(current + changeInBytes, 0);
+    } while (!externalBytes_.compare_exchange_weak(current, adjusted, std::memory_order_relaxed));
+    UpdateMax(peakBytes_, GetTotalBytes());
+    return adjusted;
+}
+
+size_t NativeMemoryAccounting::GetTotalBytes() const
+{
+    return bindingBytes_.load(std::memory_order_relaxed) +
+        static_cast<size_t>(externalBytes_.load(std::memory_order_relaxed));
+}
+
+bool NativeMemoryAccounting::ShouldRequestGC(size_t stepBytes)
+{
+    size_t total = GetTotalBytes();
+    size_t base = gcBaseBytes_.load(std::memory_order_relaxed);
+    if (total < base + stepBytes || !gcBaseBytes_.compare_exchange_strong(base, total, std::memory_order_relaxed)) {
+        return false;
+    }
+    gcRequests_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void NativeMemoryAccounting::NotifyGC()
+{
+    gcBaseBytes_.store(GetTotalBytes(), std::memory_order_relaxed);
+}
+
+void NativeMemoryAccounting::GetSnapshot(NativeMemorySnapshot& snapshot) const
+{
+    snapshot.timestampMs = NowMs();
+    snapshot.bindingObjects = GetBindingObjects();
+    snapshot.bindingBytes = GetBindingBytes();
+    snapshot.externalBytes = GetExternalBytes();
+    snapshot.peakBytes = GetPeakBytes();
+    snapshot.gcRequests = GetGCRequests();
+    snapshot.tags.clear();
+    for (const TagEntry& entry : tags_) {
+        uintptr_t tag = entry.tag.load(std::memory_order_acquire);
+        if (tag != 0) {
+            CollectTag(entry, tag, snapshot.tags);
+        }
+    }
+    CollectTag(otherTag_, 0, snapshot.tags);
+    for (auto& stats : snapshot.tags) {
+        stats.module = ResolveModule(stats.tag);
+    }
+    std::sort(snapshot.tags.begin(), snapshot.tags.end(),
+        [](const NativeMemoryTagStats& lhs, const NativeMemoryTagStats& rhs) { return lhs.bytes > rhs.bytes; });
+}
+
+// Tags without live objects are left out, the counters of a slot are read one by one and may be mid-update.
+void NativeMemoryAccounting::CollectTag(const TagEntry& entry, uintptr_t tag, std::vector<NativeMemoryTagStats>& tags)
+{
+    size_t objects = entry.objects.load(std::memory_order_relaxed);
+    if (objects == 0) {
+        return;
+    }
+    NativeMemoryTagStats stats;
+    stats.tag = tag;
+    stats.objects = objects;
+    stats.bytes = entry.bytes.load(std::memory_order_relaxed);
+    stats.peakBytes = entry.peakBytes.load(std::memory_order_relaxed);
+    tags.emplace_back(std::move(stats));
+}
+
+std::string NativeMemoryAccounting::Dump(size_t maxTags) const
+{
+    NativeMemorySnapshot snapshot;
+    GetSnapshot(snapshot);
+    std::map<std::string, size_t> moduleBytes;
+    for (const auto& stats : snapshot.tags) {
+        moduleBytes[stats.module.empty() ? "<unknown>" : stats.module] += stats.bytes;
+    }
+    std::ostringstream dump;
+    dump << "native binding: " << snapshot.bindingBytes << " bytes in " << snapshot.bindingObjects
+         << " objects, external: " << snapshot.externalBytes << " bytes, peak: " << snapshot.peakBytes
+         << " bytes, gc requests: " << snapshot.gcRequests << "\n";
+    for (const auto& [module, bytes] : moduleBytes) {
+        dump << "  module " << module << ": " << bytes << " bytes\n";
+    }
+    for (size_t i = 0; i < snapshot.tags.size() && i < maxTags; i++) {
+        const NativeMemoryTagStats& stats = snapshot.tags[i];
+        dump << "  tag 0x" << std::hex << stats.tag << std::dec << ": " << stats.bytes << " bytes in "
+             << stats.objects << " objects, peak " << stats.peakBytes << " bytes\n";
+    }
+    return dump.str();
+}
+
+bool NativeMemoryAccounting::LogSnapshotIfDue(uint64_t intervalMs, size_t maxTags)
+{
+    uint64_t now = NowMs();
+    uint64_t last = lastSnapshotMs_.load(std::memory_order_relaxed);
+    if (last == 0) {
+        // the first call only starts the interval
+        lastSnapshotMs_.compare_exchange_strong(last, now, std::memory_order_relaxed);
+        return false;
+    }
+    if (now - last < intervalMs || !lastSnapshotMs_.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+        return false;
+    }
+    std::istringstream dump(Dump(maxTags));
+    std::string line;
+    while (std::getline(dump, line)) {
+        HILOG_INFO("%{public}s", line.c_str());
+    }
+    return true;
+}
+
+std::string NativeMemoryAccounting::ResolveModule(uintptr_t tag)
+{
+#if !defined(WINDOWS_PLATFORM)
+    Dl_info info;
+    if (tag != 0 && dladdr(reinterpret_cast<void*>(tag), &info) != 0 && info.dli_fname != nullptr) {
+        return info.dli_fname;
+    }
+#endif
+    return "";
+}
+
+uint64_t NativeMemoryAccounting::NowMs()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now).count());
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_MEMORY_ACCOUNTING_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_MEMORY_ACCOUNTING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct NativeMemoryTagStats {
+    // finalize callback of the objects, it names the addon that created them
+    uintptr_t tag = 0;
+    // shared object the tag lives in, empty when unknown
+    std::string module;
+    size_t objects = 0;
+    size_t bytes = 0;
+    size_t peakBytes = 0;
+};
+
+struct NativeMemorySnapshot {
+    uint64_t timestampMs = 0;
+    size_t bindingObjects = 0;
+    size_t bindingBytes = 0;
+    int64_t externalBytes = 0;
+    size_t peakBytes = 0;
+    uint64_t gcRequests = 0;
+    // sorted by bytes, largest first
+    std::vector<NativeMemoryTagStats> tags;
+};
+
+// Native memory pinned by the JS objects of one engine.
+// Wrapped and external objects created with a native binding size are counted under their finalize callback from
+// creation until finalization, napi_adjust_external_memory keeps a separate running total. Everything is atomic and
+// may be updated and read from any thread. Tags live in a fixed open addressing table whose slots are never given
+// back, tag 0 collects objects without a finalize callback and the tags that found the table full.
+class NativeMemoryAccounting {
+public:
+    NativeMemoryAccounting() = default;
+    ~NativeMemoryAccounting() = default;
+
+    NativeMemoryAccounting(const NativeMemoryAccounting&) = delete;
+    NativeMemoryAccounting& operator=(const NativeMemoryAccounting&) = delete;
+
+    void AddBinding(uintptr_t tag, size_t bytes);
+    void RemoveBinding(uintptr_t tag, size_t bytes);
+    // Returns the external total after the change, never below zero.
+    int64_t AdjustExternal(int64_t changeInBytes);
+
+    size_t GetBindingBytes() const
+    {
+        return bindingBytes_.load(std::memory_order_relaxed);
+    }
+    size_t GetBindingObjects() const
+    {
+        return bindingObjects_.load(std::memory_order_relaxed);
+    }
+    int64_t GetExternalBytes() const
+    {
+        return externalBytes_.load(std::memory_order_relaxed);
+    }
+    size_t GetPeakBytes() const
+    {
+        return peakBytes_.load(std::memory_order_relaxed);
+    }
+    uint64_t GetGCRequests() const
+    {
+        return gcRequests_.load(std::memory_order_relaxed);
+    }
+
+    // GC pressure heuristic: true once the total grew by |stepBytes| since the last GC, then not again until
+    // NotifyGC or another step.
+    bool ShouldRequestGC(size_t stepBytes);
+    void NotifyGC();
+
+    void GetSnapshot(NativeMemorySnapshot& snapshot) const;
+    // Totals per module, then the |maxTags| largest tags.
+    std::string Dump(size_t maxTags) const;
+    // Logs a snapshot at most once per |intervalMs|, returns true when it did.
+    bool LogSnapshotIfDue(uint64_t intervalMs, size_t maxTags);
+
+    // a power of two, finalize callbacks are few per process
+    static constexpr size_t MAX_TAGS = 256;
+
+private:
+    struct TagEntry {
+        // 0 while the slot is free
+        std::atomic<uintptr_t> tag {0};
+        std::atomic<size_t> objects {0};
+        std::atomic<size_t> bytes {0};
+        std::atomic<size_t> peakBytes {0};
+    };
+
+    // Returns the slot of |tag|, claims a free one when |insert|. nullptr when |tag| has never been added.
+    TagEntry* FindTag(uintptr_t tag, bool insert);
+    static void CollectTag(const TagEntry& entry, uintptr_t tag, std::vector<NativeMemoryTagStats>& tags);
+    static void UpdateMax(std::atomic<size_t>& target, size_t value);
+    size_t GetTotalBytes() const;
+    static std::string ResolveModule(uintptr_t tag);
+    static uint64_t NowMs();
+
+    std::atomic<size_t> bindingObjects_ {0};
+    std::atomic<size_t> bindingBytes_ {0};
+    std::atomic<int64_t> externalBytes_ {0};
+    std::atomic<size_t> peakBytes_ {0};
+    std::atomic<size_t> gcBaseBytes_ {0};
+    std::atomic<uint64_t> gcRequests_ {0};
+    std::atomic<uint64_t> lastSnapshotMs_ {0};
+    TagEntry tags_[MAX_TAGS];
+    TagEntry otherTag_;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_MEMORY_ACCOUNTING_H */
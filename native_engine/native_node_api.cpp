@@ -15,6 +15,7 @@
 
 #include "native_api_internal.h"
 #include "native_engine/native_async_hook_context.h"
+#include "native_engine/native_async_work_batch.h"
 #include "native_engine/native_utils.h"
 #include "native_engine/impl/ark/ark_native_engine.h"
 
@@ -25,6 +26,7 @@ using panda::ObjectRef;
 static constexpr int32_t MAX_THREAD_SAFE_COUNT = 128;
 static constexpr size_t SMALL_STRING_SIZE = 16;
 static constexpr size_t INT_ARG_2 = 2;
+static constexpr size_t ASYNC_RESOURCE_NAME_SIZE = 64;
 
 struct WrapperData {
     void* data;
@@ -117,6 +119,16 @@ NAPI_EXTERN napi_status napi_fatal_exception(napi_env env, napi_value err)
     return napi_ok;
 }
 
+static void GetAsyncResourceName(const EcmaVM* vm, Local<panda::JSValueRef> value,
+                                 char (&name)[ASYNC_RESOURCE_NAME_SIZE])
+{
+    if (!(value->IsNull() || value->IsUndefined())) {
+        Local<StringRef> nativeString(value);
+        int copied = nativeString->WriteUtf8(vm, name, static_cast<int>(ASYNC_RESOURCE_NAME_SIZE - 1), true) - 1;
+        name[copied] = '\0';
+    }
+}
+
 // Methods to manage simple async operations
 NAPI_EXTERN napi_status napi_create_async_work(napi_env env,
                                                napi_value async_resource,
@@ -139,14 +151,10 @@ NAPI_EXTERN napi_status napi_create_async_work(napi_env env,
     auto asyncExecute = reinterpret_cast<NativeAsyncExecuteCallback>(execute);
     auto asyncComplete = reinterpret_cast<NativeAsyncCompleteCallback>(complete);
     (void)asyncResource;
-    (void)asyncResourceName;
-    char name[64] = {0}; // 64:NAME_BUFFER_SIZE
-    if (!(asyncResourceName->IsNull() || asyncResourceName->IsUndefined())) {
-        panda::Local<panda::StringRef> nativeString(asyncResourceName);
-        int copied = nativeString->WriteUtf8(ecmaVm, name, 63, true) - 1;  // 63:NAME_BUFFER_SIZE
-        name[copied] = '\0';
-    }
-    auto asyncWork  = new NativeAsyncWork(engine, asyncExecute, asyncComplete, name, data);
+    char name[ASYNC_RESOURCE_NAME_SIZE] = {0};
+    GetAsyncResourceName(ecmaVm, asyncResourceName, name);
+    auto asyncWork = NativeAsyncWork::Create(engine, asyncExecute, asyncComplete, name, data);
+    RETURN_STATUS_IF_FALSE(env, asyncWork != nullptr, napi_generic_failure);
     *result = reinterpret_cast<napi_async_work>(asyncWork);
     return napi_status::napi_ok;
 }
@@ -157,7 +165,7 @@ NAPI_EXTERN napi_status napi_delete_async_work(napi_env env, napi_async_work wor
     CHECK_ARG(env, work);
 
     auto asyncWork = reinterpret_cast<NativeAsyncWork*>(work);
-    delete asyncWork;
+    NativeAsyncWork::Destroy(reinterpret_cast<NativeEngine*>(env), asyncWork);
     asyncWork = nullptr;
 
     return napi_status::napi_ok;
@@ -174,6 +182,31 @@ NAPI_EXTERN napi_status napi_queue_async_work(napi_env env, napi_async_work work
     return napi_status::napi_ok;
 }
 
+NAPI_EXTERN napi_status napi_queue_async_work_batch(napi_env env,
+                                                    napi_value async_resource_name,
+                                                    napi_async_execute_callback execute,
+                                                    void* const* data,
+                                                    size_t count,
+                                                    napi_async_complete_callback complete,
+                                                    void* complete_data,
+                                                    napi_qos_t qos)
+{
+    CHECK_ENV(env);
+    CHECK_ARG(env, async_resource_name);
+    CHECK_ARG(env, execute);
+    CHECK_ARG(env, data);
+    CHECK_ARG(env, complete);
+    RETURN_STATUS_IF_FALSE(env, count > 0, napi_invalid_arg);
+
+    SWITCH_CONTEXT(env);
+    char name[ASYNC_RESOURCE_NAME_SIZE] = {0};
+    GetAsyncResourceName(engine->GetEcmaVm(), LocalValueFromJsValue(async_resource_name), name);
+    bool queued = NativeAsyncWorkBatch::Queue(engine, name, reinterpret_cast<NativeAsyncExecuteCallback>(execute),
+        data, count, reinterpret_cast<NativeAsyncCompleteCallback>(complete), complete_data, qos);
+    RETURN_STATUS_IF_FALSE(env, queued, napi_generic_failure);
+    return napi_clear_last_error(env);
+}
+
 NAPI_EXTERN napi_status napi_cancel_async_work(napi_env env, napi_async_work work)
 {
     CHECK_ENV(env);
@@ -181,8 +214,9 @@ NAPI_EXTERN napi_status napi_cancel_async_work(napi_env env, napi_async_work wor
 
     auto asyncWork = reinterpret_cast<NativeAsyncWork*>(work);
 
-    asyncWork->Cancel(reinterpret_cast<NativeEngine*>(env));
-    return napi_status::napi_ok;
+    // fails once execute has started, like uv_cancel
+    RETURN_STATUS_IF_FALSE(env, asyncWork->Cancel(reinterpret_cast<NativeEngine*>(env)), napi_generic_failure);
+    return napi_clear_last_error(env);
 }
 
 // Version management
@@ -369,10 +403,10 @@ NAPI_EXTERN napi_status napi_remove_async_cleanup_hook(napi_async_cleanup_hook_h
 }
 
 // Methods to manager threadsafe
-NAPI_EXTERN napi_status napi_create_threadsafe_function(napi_env env, napi_value func, napi_value async_resource,
+static napi_status CreateThreadsafeFunction(napi_env env, napi_value func, napi_value async_resource,
     napi_value async_resource_name, size_t max_queue_size, size_t initial_thread_count, void* thread_finalize_data,
     napi_finalize thread_finalize_cb, void* context, napi_threadsafe_function_call_js call_js_cb,
-    napi_threadsafe_function* result)
+    napi_threadsafe_function_queue_type queue_type, size_t payload_size, napi_threadsafe_function* result)
 {
     CHECK_ENV(env);
     CHECK_ARG(env, async_resource_name);
@@ -382,6 +416,11 @@ NAPI_EXTERN napi_status napi_create_threadsafe_function(napi_env env, napi_value
     if (func == nullptr) {
         CHECK_ARG(env, call_js_cb);
     }
+    RETURN_STATUS_IF_FALSE(env, queue_type == napi_tsfn_queue_default ||
+        (queue_type == napi_tsfn_queue_lock_free && max_queue_size > 0), napi_invalid_arg);
+    // payload slots are recycled under the queue lock, so inline payloads stay on the default queue
+    RETURN_STATUS_IF_FALSE(env, payload_size == 0 || (queue_type == napi_tsfn_queue_default && max_queue_size > 0 &&
+        payload_size <= NativeSafeAsyncWork::MAX_INLINE_PAYLOAD_SIZE), napi_invalid_arg);
 
     SWITCH_CONTEXT(env);
     auto finalizeCallback = reinterpret_cast<NativeFinalize>(thread_finalize_cb);
@@ -390,26 +429,52 @@ NAPI_EXTERN napi_status napi_create_threadsafe_function(napi_env env, napi_value
         initial_thread_count, thread_finalize_data, finalizeCallback, context, callJsCallback);
     CHECK_ENV(safeAsyncWork);
 
-    auto ret = safeAsyncWork->Init();
-    if (ret) {
-        *result = reinterpret_cast<napi_threadsafe_function>(safeAsyncWork);
-    } else {
+    // nothing has been published before Init succeeds, a failed work is deleted with its reference
+    if ((queue_type == napi_tsfn_queue_lock_free && !safeAsyncWork->InitLockFreeQueue()) ||
+        (payload_size > 0 && !safeAsyncWork->InitInlinePayload(payload_size)) || !safeAsyncWork->Init()) {
+        delete safeAsyncWork;
         return napi_status::napi_generic_failure;
     }
+    *result = reinterpret_cast<napi_threadsafe_function>(safeAsyncWork);
 
     return napi_status::napi_ok;
 }
 
-NAPI_EXTERN napi_status napi_call_threadsafe_function(
-    napi_threadsafe_function func, void* data, napi_threadsafe_function_call_mode is_blocking)
+NAPI_EXTERN napi_status napi_create_threadsafe_function(napi_env env, napi_value func, napi_value async_resource,
+    napi_value async_resource_name, size_t max_queue_size, size_t initial_thread_count, void* thread_finalize_data,
+    napi_finalize thread_finalize_cb, void* context, napi_threadsafe_function_call_js call_js_cb,
+    napi_threadsafe_function* result)
 {
-    CHECK_ENV(func);
+    return CreateThreadsafeFunction(env, func, async_resource, async_resource_name, max_queue_size,
+        initial_thread_count, thread_finalize_data, thread_finalize_cb, context, call_js_cb,
+        napi_tsfn_queue_default, 0, result);
+}
 
-    auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
-    auto callMode = static_cast<NativeThreadSafeFunctionCallMode>(is_blocking);
+NAPI_EXTERN napi_status napi_create_threadsafe_function_with_queue_type(napi_env env, napi_value func,
+    napi_value async_resource, napi_value async_resource_name, size_t max_queue_size, size_t initial_thread_count,
+    void* thread_finalize_data, napi_finalize thread_finalize_cb, void* context,
+    napi_threadsafe_function_call_js call_js_cb, napi_threadsafe_function_queue_type queue_type,
+    napi_threadsafe_function* result)
+{
+    return CreateThreadsafeFunction(env, func, async_resource, async_resource_name, max_queue_size,
+        initial_thread_count, thread_finalize_data, thread_finalize_cb, context, call_js_cb, queue_type, 0, result);
+}
 
+NAPI_EXTERN napi_status napi_create_threadsafe_function_with_inline_payload(napi_env env, napi_value func,
+    napi_value async_resource, napi_value async_resource_name, size_t max_queue_size, size_t initial_thread_count,
+    void* thread_finalize_data, napi_finalize thread_finalize_cb, void* context,
+    napi_threadsafe_function_call_js call_js_cb, size_t payload_size, napi_threadsafe_function* result)
+{
+    CHECK_ENV(env);
+    RETURN_STATUS_IF_FALSE(env, payload_size > 0, napi_invalid_arg);
+    return CreateThreadsafeFunction(env, func, async_resource, async_resource_name, max_queue_size,
+        initial_thread_count, thread_finalize_data, thread_finalize_cb, context, call_js_cb,
+        napi_tsfn_queue_default, payload_size, result);
+}
+
+static napi_status SafeAsyncCodeToStatus(SafeAsyncCode code)
+{
     napi_status status = napi_status::napi_ok;
-    auto code = safeAsyncWork->Send(data, callMode);
     switch (code) {
         case SafeAsyncCode::SAFE_ASYNC_OK:
             status = napi_status::napi_ok;
@@ -430,10 +495,32 @@ NAPI_EXTERN napi_status napi_call_threadsafe_function(
             HILOG_FATAL("this branch is unreachable, code is %{public}d", code);
             break;
     }
-
     return status;
 }
 
+NAPI_EXTERN napi_status napi_call_threadsafe_function(
+    napi_threadsafe_function func, void* data, napi_threadsafe_function_call_mode is_blocking)
+{
+    CHECK_ENV(func);
+
+    auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
+    auto callMode = static_cast<NativeThreadSafeFunctionCallMode>(is_blocking);
+
+    return SafeAsyncCodeToStatus(safeAsyncWork->Send(data, callMode));
+}
+
+NAPI_EXTERN napi_status napi_call_threadsafe_function_with_payload(
+    napi_threadsafe_function func, const void* payload, napi_threadsafe_function_call_mode is_blocking)
+{
+    CHECK_ENV(func);
+    CHECK_ENV(payload);
+
+    auto safeAsyncWork = reinterpret_cast<NativeSafeAsyncWork*>(func);
+    auto callMode = static_cast<NativeThreadSafeFunctionCallMode>(is_blocking);
+
+    return SafeAsyncCodeToStatus(safeAsyncWork->SendPayload(payload, callMode));
+}
+
 NAPI_EXTERN napi_status napi_acquire_threadsafe_function(napi_threadsafe_function func)
 {
     CHECK_ENV(func);
@@ -801,10 +888,12 @@ NAPI_EXTERN napi_status napi_wrap_enhance_s(napi_env env,
         }
     } else {
         if (reference != nullptr) {
-            ref = engine->CreateAsyncReference(js_object, 1, false, callback, native_object, finalize_hint);
+            ref = engine->CreateAsyncReference(js_object, 1, false, callback, native_object, finalize_hint,
+                                               native_binding_size);
             *reference = ref;
         } else {
-            ref = engine->CreateAsyncReference(js_object, 0, true, callback, native_object, finalize_hint);
+            ref = engine->CreateAsyncReference(js_object, 0, true, callback, native_object, finalize_hint,
+                                               native_binding_size);
         }
     }
     object->SetNativePointerFieldCount(vm, INT_ARG_2);
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_reference_leak_tracker.h"
+
+#include <algorithm>
+#include <sstream>
+
+#if !defined(WINDOWS_PLATFORM)
+#include <dlfcn.h>
+#include <unwind.h>
+#endif
+
+void NativeReferenceLeakTracker::SetInterval(uint32_t interval, bool captureJsStack)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    interval_.store(interval, std::memory_order_relaxed);
+    captureJsStack_.store(captureJsStack, std::memory_order_relaxed);
+    counter_.store(0, std::memory_order_relaxed);
+    if (interval == 0) {
+        references_.clear();
+        sites_.clear();
+    }
+}
+
+void NativeReferenceLeakTracker::Record(const void* reference, std::string&& jsStack)
+{
+    uintptr_t site = CaptureSite();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (interval_.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    auto iter = sites_.find(site);
+    if (iter == sites_.end()) {
+        if (sites_.size() >= MAX_SITES) {
+            site = 0;
+        }
+        iter = sites_.try_emplace(site).first;
+        if (iter->second.sampled == 0) {
+            iter->second.jsStack = std::move(jsStack);
+        }
+    }
+    iter->second.outstanding++;
+    iter->second.sampled++;
+    references_[reference] = site;
+}
+
+void NativeReferenceLeakTracker::Forget(const void* reference)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = references_.find(reference);
+    if (iter == references_.end()) {
+        return;
+    }
+    auto site = sites_.find(iter->second);
+    if (site != sites_.end() && site->second.outstanding > 0) {
+        site->second.outstanding--;
+    }
+    references_.erase(iter);
+}
+
+size_t NativeReferenceLeakTracker::GetOutstanding() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return references_.size();
+}
+
+std::vector<NativeReferenceSiteStats> NativeReferenceLeakTracker::GetSites() const
+{
+    std::vector<NativeReferenceSiteStats> sites;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sites.reserve(sites_.size());
+        for (const auto& [site, entry] : sites_) {
+            NativeReferenceSiteStats stats;
+            stats.site = site;
+            stats.outstanding = entry.outstanding;
+            stats.sampled = entry.sampled;
+            stats.jsStack = entry.jsStack;
+            sites.emplace_back(std::move(stats));
+        }
+    }
+#if !defined(WINDOWS_PLATFORM)
+    // resolved outside the lock, dladdr takes the loader lock
+    for (auto& stats : sites) {
+        Dl_info info;
+        if (stats.site != 0 && dladdr(reinterpret_cast<void*>(stats.site), &info) != 0) {
+            stats.module = info.dli_fname != nullptr ? info.dli_fname : "";
+            stats.symbol = info.dli_sname != nullptr ? info.dli_sname : "";
+        }
+    }
+#endif
+    std::sort(sites.begin(), sites.end(), [](const NativeReferenceSiteStats& lhs, const NativeReferenceSiteStats& rhs) {
+        return lhs.outstanding > rhs.outstanding;
+    });
+    return sites;
+}
+
+std::string NativeReferenceLeakTracker::Dump(size_t maxSites) const
+{
+    uint32_t interval = GetInterval();
+    std::vector<NativeReferenceSiteStats> sites = GetSites();
+    size_t outstanding = 0;
+    for (const auto& stats : sites) {
+        outstanding += stats.outstanding;
+    }
+    std::ostringstream dump;
+    dump << "reference sampling 1/" << interval << ": " << outstanding << " outstanding in " << sites.size()
+         << " sites, about " << outstanding * interval << " references\n";
+    for (size_t i = 0; i < sites.size() && i < maxSites; i++) {
+        const NativeReferenceSiteStats& stats = sites[i];
+        dump << "  site 0x" << std::hex << stats.site << std::dec << " "
+             << (stats.module.empty() ? "<unknown>" : stats.module);
+        if (!stats.symbol.empty()) {
+            dump << " (" << stats.symbol << ")";
+        }
+        dump << ": " << stats.outstanding << " outstanding of " << stats.sampled << " sampled\n";
+        if (!stats.jsStack.empty()) {
+            std::istringstream jsStack(stats.jsStack);
+            std::string line;
+            while (std::getline(jsStack, line)) {
+                dump << "    " << line << "\n";
+            }
+        }
+    }
+    return dump.str();
+}
+
+uintptr_t NativeReferenceLeakTracker::CaptureSite()
+{
+#if !defined(WINDOWS_PLATFORM)
+    struct Frames {
+        uintptr_t pcs[MAX_FRAMES];
+        size_t count;
+    } frames {{}, 0};
+    _Unwind_Backtrace([](struct _Unwind_Context* context, void* arg) {
+        auto frames = reinterpret_cast<Frames*>(arg);
+        uintptr_t pc = _Unwind_GetIP(context);
+        if (pc == 0 || frames->count >= MAX_FRAMES) {
+            return _URC_END_OF_STACK;
+        }
+        frames->pcs[frames->count++] = pc;
+        return _URC_NO_REASON;
+    }, &frames);
+
+    // the first frame outside of this library called into napi
+    static const void* ownBase = []() -> const void* {
+        Dl_info info;
+        return dladdr(reinterpret_cast<void*>(&NativeReferenceLeakTracker::CaptureSite), &info) != 0 ?
+            info.dli_fbase : nullptr;
+    }();
+    for (size_t i = 0; i < frames.count; i++) {
+        Dl_info info;
+        if (dladdr(reinterpret_cast<void*>(frames.pcs[i]), &info) != 0 && info.dli_fbase != ownBase) {
+            return frames.pcs[i];
+        }
+    }
+    // linked statically, there is no telling the caller apart
+    return 0;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_REFERENCE_LEAK_TRACKER_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_REFERENCE_LEAK_TRACKER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct NativeReferenceSiteStats {
+    // first return address outside of napi, the native code that created the references
+    uintptr_t site = 0;
+    // shared object and symbol of the site, empty when unknown
+    std::string module;
+    std::string symbol;
+    size_t outstanding = 0;
+    size_t sampled = 0;
+    // JS stack of the first sampled reference, when JS stacks are captured
+    std::string jsStack;
+};
+
+// Allocation sites of the references of one engine, sampled 1 in |interval|.
+// A sampled reference is mapped to the native caller that created it until it is deleted, so sites whose
+// outstanding count keeps growing point at leaks; an estimate of the real count is outstanding * interval.
+// Disabled it costs one relaxed load per reference. Sites are capped at MAX_SITES, later ones count under site 0.
+class NativeReferenceLeakTracker {
+public:
+    static constexpr size_t MAX_SITES = 1024;
+
+    NativeReferenceLeakTracker() = default;
+    ~NativeReferenceLeakTracker() = default;
+
+    NativeReferenceLeakTracker(const NativeReferenceLeakTracker&) = delete;
+    NativeReferenceLeakTracker& operator=(const NativeReferenceLeakTracker&) = delete;
+
+    // |interval| 0 stops sampling and forgets what was recorded.
+    void SetInterval(uint32_t interval, bool captureJsStack);
+    uint32_t GetInterval() const
+    {
+        return interval_.load(std::memory_order_relaxed);
+    }
+    bool IsCapturingJsStack() const
+    {
+        return captureJsStack_.load(std::memory_order_relaxed);
+    }
+
+    bool ShouldSample()
+    {
+        uint32_t interval = interval_.load(std::memory_order_relaxed);
+        if (__builtin_expect(interval == 0, true)) {
+            return false;
+        }
+        return counter_.fetch_add(1, std::memory_order_relaxed) % interval == 0;
+    }
+    // Maps |reference| to the native code that called into napi. |jsStack| is kept for a new site only.
+    void Record(const void* reference, std::string&& jsStack);
+    void Forget(const void* reference);
+
+    size_t GetOutstanding() const;
+    // sorted by outstanding references, most first
+    std::vector<NativeReferenceSiteStats> GetSites() const;
+    // The |maxSites| sites with most outstanding references.
+    std::string Dump(size_t maxSites) const;
+
+private:
+    static constexpr size_t MAX_FRAMES = 32;
+
+    struct Site {
+        size_t outstanding = 0;
+        size_t sampled = 0;
+        std::string jsStack;
+    };
+
+    static uintptr_t CaptureSite();
+
+    std::atomic<uint32_t> interval_ {0};
+    std::atomic<bool> captureJsStack_ {false};
+    std::atomic<uint32_t> counter_ {0};
+    // guards references_ and sites_
+    mutable std::mutex mutex_;
+    std::unordered_map<const void*, uintptr_t> references_;
+    std::unordered_map<uintptr_t, Site> sites_;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_REFERENCE_LEAK_TRACKER_H */
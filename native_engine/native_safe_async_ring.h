@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SAFE_ASYNC_RING_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SAFE_ASYNC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+// Bounded multi-producer/single-consumer ring of void*.
+// Every cell carries a sequence number: producers claim a position with one CAS on tail_ and publish the
+// cell by bumping its sequence, the single consumer reads cells in order without any atomic RMW.
+// Capacity is rounded up to a power of two, callers that need an exact bound must admit items themselves.
+class NativeSafeAsyncRing {
+public:
+    explicit NativeSafeAsyncRing(size_t capacity)
+    {
+        size_t size = MIN_CAPACITY;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mask_ = size - 1;
+        cells_ = std::unique_ptr<Cell[]>(new (std::nothrow) Cell[size]);
+        if (cells_ == nullptr) {
+            mask_ = 0;
+            return;
+        }
+        for (size_t i = 0; i < size; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    ~NativeSafeAsyncRing() = default;
+
+    NativeSafeAsyncRing(const NativeSafeAsyncRing&) = delete;
+    NativeSafeAsyncRing& operator=(const NativeSafeAsyncRing&) = delete;
+
+    bool IsValid() const
+    {
+        return cells_ != nullptr;
+    }
+
+    size_t Capacity() const
+    {
+        return mask_ + 1;
+    }
+
+    // Thread safe, returns false when the ring is full.
+    bool TryPush(void* data)
+    {
+        Cell* cell = nullptr;
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = data;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer thread only. Returns false when the next cell is not published yet.
+    bool TryPop(void*& data)
+    {
+        Cell& cell = cells_[head_ & mask_];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if (seq != head_ + 1) {
+            return false;
+        }
+        data = cell.data;
+        cell.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+        head_++;
+        return true;
+    }
+
+private:
+    static constexpr size_t MIN_CAPACITY = 2;
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence {0};
+        void* data {nullptr};
+    };
+
+    std::unique_ptr<Cell[]> cells_ {nullptr};
+    size_t mask_ {0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_ {0};
+    alignas(CACHE_LINE_SIZE) size_t head_ {0};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SAFE_ASYNC_RING_H */
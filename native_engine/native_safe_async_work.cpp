@@ -123,7 +123,10 @@ NativeSafeAsyncWork::~NativeSafeAsyncWork()
         delete ref_;
         ref_ = nullptr;
     }
-    engine_->DecreaseActiveTsfnCounter();
+    // the counter was only increased by a successful Init
+    if (status_ != SafeAsyncStatus::UNKNOW) {
+        engine_->DecreaseActiveTsfnCounter();
+    }
 }
 
 bool NativeSafeAsyncWork::Init()
@@ -155,9 +158,52 @@ bool NativeSafeAsyncWork::Init()
     return true;
 }
 
+bool NativeSafeAsyncWork::InitLockFreeQueue()
+{
+    if (maxQueueSize_ == 0) {
+        HILOG_ERROR("lock-free queue requires a max queue size");
+        return false;
+    }
+    ring_ = std::make_unique<NativeSafeAsyncRing>(maxQueueSize_);
+    if (!ring_->IsValid()) {
+        HILOG_ERROR("failed to allocate lock-free queue, size: %{public}zu", maxQueueSize_);
+        ring_.reset();
+        return false;
+    }
+    return true;
+}
+
+bool NativeSafeAsyncWork::InitInlinePayload(size_t payloadSize)
+{
+    if (maxQueueSize_ == 0 || payloadSize == 0 || payloadSize > MAX_INLINE_PAYLOAD_SIZE) {
+        HILOG_ERROR("invalid inline payload, size: %{public}zu, max queue size: %{public}zu",
+                    payloadSize, maxQueueSize_);
+        return false;
+    }
+    if (ring_ != nullptr) {
+        HILOG_ERROR("inline payload is not supported on the lock-free queue");
+        return false;
+    }
+    // queue_ holds at most maxQueueSize_ + 1 items, and a batch drain keeps as many in flight while producers
+    // refill queue_, so the slots never run out before the queue bound does.
+    size_t slotCount = (maxQueueSize_ + 1) * 2;
+    size_t slotUnits = (payloadSize + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+    payloadSlots_ = std::unique_ptr<std::max_align_t[]>(new (std::nothrow) std::max_align_t[slotCount * slotUnits]);
+    if (payloadSlots_ == nullptr) {
+        HILOG_ERROR("failed to allocate inline payload slots, count: %{public}zu", slotCount);
+        return false;
+    }
+    freeSlots_.reserve(slotCount);
+    for (size_t i = slotCount; i > 0; i--) {
+        freeSlots_.emplace_back(&payloadSlots_[(i - 1) * slotUnits]);
+    }
+    payloadSize_ = payloadSize;
+    return true;
+}
+
 bool NativeSafeAsyncWork::IsMaxQueueSize()
 {
-    return (queue_.size() > maxQueueSize_ &&
+    return (QueueSize() > maxQueueSize_ &&
            maxQueueSize_ > 0 &&
            status_ != SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING &&
            status_ != SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED);
@@ -179,6 +225,28 @@ SafeAsyncCode NativeSafeAsyncWork::ValidEngineCheck()
 }
 
 SafeAsyncCode NativeSafeAsyncWork::Send(void* data, NativeThreadSafeFunctionCallMode mode)
+{
+    if (payloadSize_ > 0) {
+        HILOG_ERROR("threadsafe function with inline payload only accepts payload calls");
+        return SafeAsyncCode::SAFE_ASYNC_INVALID_ARGS;
+    }
+    if (ring_ != nullptr) {
+        return SendToRing(data, mode);
+    }
+    return SendToQueue(data, nullptr, mode);
+}
+
+SafeAsyncCode NativeSafeAsyncWork::SendPayload(const void* payload, NativeThreadSafeFunctionCallMode mode)
+{
+    if (payloadSize_ == 0 || payload == nullptr) {
+        HILOG_ERROR("threadsafe function has no inline payload or payload is nullptr");
+        return SafeAsyncCode::SAFE_ASYNC_INVALID_ARGS;
+    }
+    return SendToQueue(nullptr, payload, mode);
+}
+
+// |payload| is copied into a free slot which is queued instead of |data|.
+SafeAsyncCode NativeSafeAsyncWork::SendToQueue(void* data, const void* payload, NativeThreadSafeFunctionCallMode mode)
 {
     std::unique_lock<std::mutex> lock(mutex_);
     if (IsMaxQueueSize()) {
@@ -205,8 +273,20 @@ SafeAsyncCode NativeSafeAsyncWork::Send(void* data, NativeThreadSafeFunctionCall
         if (checkRet != SafeAsyncCode::SAFE_ASYNC_OK) {
             return checkRet;
         }
+        if (payload != nullptr) {
+            if (freeSlots_.empty()) {
+                HILOG_ERROR("inline payload slots are unexpectedly exhausted");
+                return SafeAsyncCode::SAFE_ASYNC_QUEUE_FULL;
+            }
+            data = freeSlots_.back();
+            if (memcpy_s(data, payloadSize_, payload, payloadSize_) != EOK) {
+                HILOG_ERROR("failed to copy inline payload");
+                return SafeAsyncCode::SAFE_ASYNC_FAILED;
+            }
+            freeSlots_.pop_back();
+        }
         queue_.emplace_back(data);
-        auto ret = uv_async_send(&asyncHandler_);
+        auto ret = SendWakeup();
         if (ret != 0) {
             HILOG_ERROR("uv async send failed in Send ret = %{public}d", ret);
             return SafeAsyncCode::SAFE_ASYNC_FAILED;
@@ -216,6 +296,140 @@ SafeAsyncCode NativeSafeAsyncWork::Send(void* data, NativeThreadSafeFunctionCall
     return SafeAsyncCode::SAFE_ASYNC_OK;
 }
 
+bool NativeSafeAsyncWork::TryReserveRing()
+{
+    size_t pending = ringPending_.load(std::memory_order_relaxed);
+    do {
+        if (pending >= maxQueueSize_) {
+            return false;
+        }
+    } while (!ringPending_.compare_exchange_weak(pending, pending + 1, std::memory_order_acq_rel));
+    return true;
+}
+
+SafeAsyncCode NativeSafeAsyncWork::SendToRing(void* data, NativeThreadSafeFunctionCallMode mode)
+{
+    auto isClosed = [this]() {
+        return status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED ||
+               status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING;
+    };
+
+    bool reserved = TryReserveRing();
+    if (!reserved && !isClosed()) {
+        if (mode != NATIVE_TSFUNC_BLOCKING) {
+            return SafeAsyncCode::SAFE_ASYNC_QUEUE_FULL;
+        }
+        // only blocking producers of a full queue ever take the lock
+        std::unique_lock<std::mutex> lock(mutex_);
+        ringWaiters_++;
+        condition_.wait(lock, [this, &reserved, &isClosed]() {
+            reserved = TryReserveRing();
+            return reserved || isClosed();
+        });
+        ringWaiters_--;
+    }
+
+    // counted before the status check, pairs with the status store and the wait in CloseHandles
+    ringProducers_.fetch_add(1);
+    if (isClosed()) {
+        if (reserved) {
+            ringPending_.fetch_sub(1);
+        }
+        LeaveRing();
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (threadCount_ == 0) {
+            return SafeAsyncCode::SAFE_ASYNC_INVALID_ARGS;
+        }
+        threadCount_--;
+        return SafeAsyncCode::SAFE_ASYNC_CLOSED;
+    }
+
+    SafeAsyncCode checkRet = ValidEngineCheck();
+    if (checkRet != SafeAsyncCode::SAFE_ASYNC_OK) {
+        ringPending_.fetch_sub(1);
+        LeaveRing();
+        return checkRet;
+    }
+    // the reservation guarantees a free cell, the ring is never smaller than maxQueueSize_
+    if (!ring_->TryPush(data)) {
+        ringPending_.fetch_sub(1);
+        LeaveRing();
+        HILOG_ERROR("lock-free queue is unexpectedly full");
+        return SafeAsyncCode::SAFE_ASYNC_QUEUE_FULL;
+    }
+    auto ret = SendWakeup();
+    // the work may be deleted from here on
+    LeaveRing();
+    if (ret != 0) {
+        HILOG_ERROR("uv async send failed in SendToRing ret = %{public}d", ret);
+        return SafeAsyncCode::SAFE_ASYNC_FAILED;
+    }
+    return SafeAsyncCode::SAFE_ASYNC_OK;
+}
+
+void NativeSafeAsyncWork::LeaveRing()
+{
+    size_t producers = ringProducers_.load();
+    while ((producers & RING_CLOSING) == 0) {
+        // nothing waits yet, the work is not touched after the exchange
+        if (ringProducers_.compare_exchange_weak(producers, producers - 1)) {
+            return;
+        }
+    }
+    // CloseHandles waits for us, it wakes up only once the lock is released
+    std::lock_guard<std::mutex> lock(mutex_);
+    ringProducers_.fetch_sub(1);
+    condition_.notify_all();
+}
+
+int NativeSafeAsyncWork::SendWakeup()
+{
+    if (wakeupPending_.exchange(true, std::memory_order_acq_rel)) {
+        wakeupsElided_.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+    wakeupsSent_.fetch_add(1, std::memory_order_relaxed);
+    int ret = uv_async_send(&asyncHandler_);
+    if (ret != 0) {
+        wakeupPending_.store(false, std::memory_order_release);
+    }
+    return ret;
+}
+
+void NativeSafeAsyncWork::GetWakeupCounters(uint64_t& sent, uint64_t& elided) const
+{
+    sent = wakeupsSent_.load(std::memory_order_relaxed);
+    elided = wakeupsElided_.load(std::memory_order_relaxed);
+}
+
+void NativeSafeAsyncWork::DrainRing()
+{
+    if (ring_ == nullptr) {
+        return;
+    }
+    void* data = nullptr;
+    while (ring_->TryPop(data)) {
+        queue_.emplace_back(data);
+    }
+}
+
+// Called with mutex_ held, frees ring reservations and wakes blocked producers if there are any.
+void NativeSafeAsyncWork::OnItemsConsumed(size_t count)
+{
+    if (ring_ == nullptr || count == 0) {
+        return;
+    }
+    ringPending_.fetch_sub(count);
+    if (ringWaiters_ == 0) {
+        return;
+    }
+    if (count == 1) {
+        condition_.notify_one();
+    } else {
+        condition_.notify_all();
+    }
+}
+
 SafeAsyncCode NativeSafeAsyncWork::Acquire()
 {
     std::unique_lock<std::mutex> lock(mutex_);
@@ -254,7 +468,9 @@ SafeAsyncCode NativeSafeAsyncWork::Release(NativeThreadSafeFunctionReleaseMode m
 
     if (mode == NativeThreadSafeFunctionReleaseMode::NATIVE_TSFUNC_ABORT) {
         status_ = SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING;
-        if (maxQueueSize_ > 0) {
+        if (ring_ != nullptr) {
+            condition_.notify_all();
+        } else if (maxQueueSize_ > 0) {
             condition_.notify_one();
         }
     }
@@ -305,8 +521,27 @@ void* NativeSafeAsyncWork::GetContext()
     return context_;
 }
 
+bool NativeSafeAsyncWork::SetBatchCallJsCallback(NativeThreadSafeFunctionCallJsBatch callJsBatchCallback)
+{
+    if (!IsSameTid()) {
+        HILOG_ERROR("tid not same");
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED ||
+        status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING) {
+        HILOG_WARN("Do not set batch callback, thread is closed!");
+        return false;
+    }
+    callJsBatchCallback_ = callJsBatchCallback;
+    return true;
+}
+
 void NativeSafeAsyncWork::ProcessAsyncHandle()
 {
+    // posts from now on must wake the loop again, acquire pairs with the producer's exchange in SendWakeup
+    wakeupPending_.exchange(false, std::memory_order_acq_rel);
     std::unique_lock<std::mutex> lock(mutex_);
     if (status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED) {
         HILOG_ERROR("Process failed, thread is closed!");
@@ -315,11 +550,12 @@ void NativeSafeAsyncWork::ProcessAsyncHandle()
 
     if (status_ == SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSING) {
         HILOG_DEBUG("threadsafe function is closing!");
-        CloseHandles();
+        CloseHandles(lock);
         return;
     }
 
-    size_t size = queue_.size();
+    DrainRing();
+    size_t size = QueueSize();
     void* data = nullptr;
 
     auto vm = engine_->GetEcmaVm();
@@ -338,8 +574,16 @@ void NativeSafeAsyncWork::ProcessAsyncHandle()
         loop = engine_->GetParent()->GetUVLoop();
     }
 
+    if (callJsBatchCallback_ != nullptr) {
+        ProcessAsyncHandleBatch(lock, loop);
+        if (tryCatch.HasCaught()) {
+            engine_->HandleUncaughtException();
+        }
+        size = 0;
+    }
+
     while (size > 0) {
-        data = queue_.front();
+        data = queue_[queueHead_];
         // when queue is full, notify send.
         if (size == maxQueueSize_ && maxQueueSize_ > 0) {
             condition_.notify_one();
@@ -364,24 +608,76 @@ void NativeSafeAsyncWork::ProcessAsyncHandle()
             engine_->HandleUncaughtException();
         }
 
-        queue_.pop_front();
+        if (payloadSize_ > 0) {
+            freeSlots_.emplace_back(data);
+        }
+        queueHead_++;
+        OnItemsConsumed(1);
         size--;
     }
+    CompactQueue();
     RestoreTraceId(isValidTraceId);
 
-    if (!queue_.empty()) {
-        auto ret = uv_async_send(&asyncHandler_);
+    if (QueueSize() > 0) {
+        auto ret = SendWakeup();
         if (ret != 0) {
             HILOG_ERROR("uv async send failed in ProcessAsyncHandle ret = %{public}d", ret);
         }
     }
 
-    if (queue_.empty() && threadCount_ == 0) {
-        CloseHandles();
+    if (QueueSize() == 0 && threadCount_ == 0) {
+        CloseHandles(lock);
+    }
+}
+
+void NativeSafeAsyncWork::CompactQueue()
+{
+    if (queueHead_ == queue_.size()) {
+        queue_.clear();
+        queueHead_ = 0;
+    } else if (queueHead_ > queue_.size() / 2) {
+        // moves at most as many items as were consumed since the last compaction
+        queue_.erase(queue_.begin(), queue_.begin() + queueHead_);
+        queueHead_ = 0;
     }
 }
 
-SafeAsyncCode NativeSafeAsyncWork::CloseHandles()
+// Drains everything queued so far with one lock round-trip and one callback, the function handle is
+// resolved once per drain instead of once per item.
+void NativeSafeAsyncWork::ProcessAsyncHandleBatch(std::unique_lock<std::mutex>& lock, [[maybe_unused]] uv_loop_t* loop)
+{
+    if (queue_.empty()) {
+        return;
+    }
+    // batchBuffer_ is empty but keeps the capacity of an earlier drain, producers refill it as the new queue_
+    batchBuffer_.swap(queue_);
+    // the queue is empty now, every blocked producer can make progress.
+    if (ring_ != nullptr) {
+        OnItemsConsumed(batchBuffer_.size());
+    } else if (maxQueueSize_ > 0) {
+        condition_.notify_all();
+    }
+    napi_value func = (ref_ == nullptr) ? nullptr : ref_->Get(engine_);
+    NativeThreadSafeFunctionCallJsBatch callJsBatchCallback = callJsBatchCallback_;
+    lock.unlock();
+
+#if defined(ENABLE_EVENT_HANDLER)
+    uv_call_specify_task(loop);
+#endif
+    NativeEngine::ExecuteCallback(__FUNCTION__, callJsBatchCallback, engine_, func, context_,
+                                  batchBuffer_.data(), batchBuffer_.size());
+    if (engine_->HasCriticalScope()) {
+        HILOG_FATAL("critical scope still open after user callback (ID: %{public}" PRIuPTR ") returned",
+                    reinterpret_cast<uintptr_t>(callJsBatchCallback));
+    }
+    lock.lock();
+    if (payloadSize_ > 0) {
+        freeSlots_.insert(freeSlots_.end(), batchBuffer_.begin(), batchBuffer_.end());
+    }
+    batchBuffer_.clear();
+}
+
+SafeAsyncCode NativeSafeAsyncWork::CloseHandles(std::unique_lock<std::mutex>& lock)
 {
     HILOG_DEBUG("NativeSafeAsyncWork::CloseHandles called");
 
@@ -391,6 +687,10 @@ SafeAsyncCode NativeSafeAsyncWork::CloseHandles()
     }
 
     status_ = SafeAsyncStatus::SAFE_ASYNC_STATUS_CLOSED;
+    // a producer that passed its status check still pushes to the ring and wakes the handle. Once RING_CLOSING is
+    // set the remaining ones leave under mutex_ and notify, CleanUp drains whatever they pushed.
+    ringProducers_.fetch_or(RING_CLOSING);
+    condition_.wait(lock, [this]() { return ringProducers_.load() == RING_CLOSING; });
 
     // close async handler
     uv_close(reinterpret_cast<uv_handle_t*>(&asyncHandler_), [](uv_handle_t* handle) {
@@ -411,13 +711,17 @@ void NativeSafeAsyncWork::CleanUp()
     }
 
     // clean data
-    while (!queue_.empty()) {
+    DrainRing();
+    if (callJsBatchCallback_ != nullptr && QueueSize() > 0) {
+        callJsBatchCallback_(nullptr, nullptr, context_, queue_.data() + queueHead_, QueueSize());
+        queueHead_ = queue_.size();
+    }
+    for (; queueHead_ < queue_.size(); queueHead_++) {
         if (callJsCallback_ != nullptr) {
-            callJsCallback_(nullptr, nullptr, context_, queue_.front());
+            callJsCallback_(nullptr, nullptr, context_, queue_[queueHead_]);
         } else {
-            CallJs(nullptr, nullptr, context_, queue_.front());
+            CallJs(nullptr, nullptr, context_, queue_[queueHead_]);
         }
-        queue_.pop_front();
     }
     ClearTraceId(isValidTraceId);
 
@@ -445,7 +749,14 @@ napi_status NativeSafeAsyncWork::PostTask(void *data, int32_t priority, bool isT
         panda::LocalScope scope(this->engine_->GetEcmaVm());
         napi_value func_ = (this->ref_ == nullptr) ? nullptr : this->ref_->Get(engine_);
         bool isValidTraceId = SaveAndSetTraceId();
-        if (this->callJsCallback_ != nullptr) {
+        if (this->callJsBatchCallback_ != nullptr) {
+            void* batch[] = { data };
+            this->callJsBatchCallback_(engine_, func_, context_, batch, 1);
+            if (engine_->HasCriticalScope()) {
+                HILOG_FATAL("critical scope still open after user callback (ID: %{public}" PRIuPTR ") returned",
+                            reinterpret_cast<uintptr_t>(callJsBatchCallback_));
+            }
+        } else if (this->callJsCallback_ != nullptr) {
             this->callJsCallback_(engine_, func_, context_, data);
             if (engine_->HasCriticalScope()) {
                 HILOG_FATAL("critical scope still open after user callback (ID: %{public}" PRIuPTR ") returned",
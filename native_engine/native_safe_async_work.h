@@ -18,14 +18,18 @@
 
 #include "native_value.h"
 
+#include <atomic>
+#include <cstddef>
 #include <mutex>
-#include <deque>
+#include <memory>
+#include <vector>
 #include <uv.h>
 #ifdef LINUX_PLATFORM
 #include <condition_variable>
 #endif
 
 #include "native_async_context.h"
+#include "native_safe_async_ring.h"
 #ifdef ENABLE_HITRACE
 #include "hitrace/trace.h"
 #endif
@@ -78,20 +82,50 @@ public:
 
     virtual ~NativeSafeAsyncWork();
     virtual bool Init();
+    // Must be called before Init, producers then bypass mutex_ unless they have to block.
+    virtual bool InitLockFreeQueue();
+    // Must be called before Init, every call then copies |payloadSize| bytes into a preallocated slot and the
+    // call-JS callback receives a pointer into that slot, valid until the callback returns.
+    virtual bool InitInlinePayload(size_t payloadSize);
     virtual SafeAsyncCode Send(void* data, NativeThreadSafeFunctionCallMode mode);
+    virtual SafeAsyncCode SendPayload(const void* payload, NativeThreadSafeFunctionCallMode mode);
     virtual SafeAsyncCode Acquire();
     virtual SafeAsyncCode Release(NativeThreadSafeFunctionReleaseMode mode);
     virtual bool Ref();
     virtual bool Unref();
     virtual void* GetContext();
     virtual napi_status PostTask(void *data, int32_t priority, bool isTail);
+    virtual bool SetBatchCallJsCallback(NativeThreadSafeFunctionCallJsBatch callJsBatchCallback);
+    void GetWakeupCounters(uint64_t& sent, uint64_t& elided) const;
+    bool HasInlinePayload() const
+    {
+        return payloadSize_ > 0;
+    }
+
+    static constexpr size_t MAX_INLINE_PAYLOAD_SIZE = 64;
 
 protected:
     void ProcessAsyncHandle();
-    SafeAsyncCode CloseHandles();
+    void ProcessAsyncHandleBatch(std::unique_lock<std::mutex>& lock, uv_loop_t* loop);
+    // Drops the consumed items once they are more than half of queue_, so the drains stay linear overall.
+    void CompactQueue();
+    // Called with mutex_ held through |lock|, waits for the producers still pushing to the ring.
+    SafeAsyncCode CloseHandles(std::unique_lock<std::mutex>& lock);
     void CleanUp();
     bool IsSameTid();
     bool IsMaxQueueSize();
+    size_t QueueSize() const
+    {
+        return queue_.size() - queueHead_;
+    }
+    SafeAsyncCode SendToQueue(void* data, const void* payload, NativeThreadSafeFunctionCallMode mode);
+    SafeAsyncCode SendToRing(void* data, NativeThreadSafeFunctionCallMode mode);
+    bool TryReserveRing();
+    void DrainRing();
+    void OnItemsConsumed(size_t count);
+    int SendWakeup();
+    // Ends the ringProducers_ count of a producer, the last ones notify CloseHandles.
+    void LeaveRing();
 
     SafeAsyncCode ValidEngineCheck();
 
@@ -104,12 +138,36 @@ protected:
     NativeFinalize finalizeCallback_ = nullptr;
     void* context_ = nullptr;
     NativeThreadSafeFunctionCallJs callJsCallback_ = nullptr;
+    NativeThreadSafeFunctionCallJsBatch callJsBatchCallback_ = nullptr;
     NativeAsyncContext asyncContext_;
     uv_async_t asyncHandler_;
     std::mutex mutex_;
-    std::deque<void*> queue_;
+    // items before queueHead_ were consumed by the per-item drains, see CompactQueue
+    std::vector<void*> queue_;
+    size_t queueHead_ {0};
+    // batch-drain mode swaps queue_ with it, so both keep their capacity, only touched on the loop thread
+    std::vector<void*> batchBuffer_;
     std::condition_variable condition_;
-    SafeAsyncStatus status_ = SafeAsyncStatus::UNKNOW;
+    std::atomic<SafeAsyncStatus> status_ {SafeAsyncStatus::UNKNOW};
+    // lock-free queue backend, items move into queue_ on the loop thread
+    std::unique_ptr<NativeSafeAsyncRing> ring_ {nullptr};
+    // items sent through ring_ and not consumed yet, bounded by maxQueueSize_
+    std::atomic<size_t> ringPending_ {0};
+    // guarded by mutex_
+    size_t ringWaiters_ {0};
+    // producers between their status check and their wakeup, CloseHandles sets RING_CLOSING and waits for them
+    // before closing the handle
+    static constexpr size_t RING_CLOSING = static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1);
+    std::atomic<size_t> ringProducers_ {0};
+    // set by the first post after a drain started, later posts skip uv_async_send until the loop clears it
+    std::atomic<bool> wakeupPending_ {false};
+    std::atomic<uint64_t> wakeupsSent_ {0};
+    std::atomic<uint64_t> wakeupsElided_ {0};
+    // inline payload slots, a queued item points into payloadSlots_ and goes back to freeSlots_ once consumed
+    size_t payloadSize_ {0};
+    std::unique_ptr<std::max_align_t[]> payloadSlots_ {nullptr};
+    // guarded by mutex_
+    std::vector<void*> freeSlots_;
 #if defined(ENABLE_EVENT_HANDLER)
     std::mutex eventHandlerMutex_;
     std::shared_ptr<OHOS::AppExecFwk::EventHandler> eventHandler_ = nullptr;
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_serial_executor.h"
+
+#include "native_api_internal.h"
+
+NativeSerialExecutorRegistry::~NativeSerialExecutorRegistry()
+{
+    // works still waiting never start
+    if (pending_ > 0) {
+        HILOG_WARN("%{public}zu ordered async works dropped with their engine", pending_);
+    }
+    // a drain may still run on the uv pool when the loop outlives the engine, its queue is freed by
+    // AfterDrainCallback instead
+    for (auto& item : queues_) {
+        SerialQueue* queue = item.second.release();
+        queue->registry = nullptr;
+        if (!queue->draining) {
+            CloseQueue(queue);
+        }
+    }
+    queues_.clear();
+}
+
+SerialEnqueueResult NativeSerialExecutorRegistry::Enqueue(uv_loop_t* loop, uintptr_t queueId, napi_qos_t qos,
+                                                          NativeAsyncWork* work)
+{
+    auto& slot = queues_[queueId];
+    if (slot == nullptr) {
+        slot = std::make_unique<SerialQueue>();
+        slot->registry = this;
+        slot->loop = loop;
+        slot->id = queueId;
+        slot->drainWork.data = slot.get();
+        int ret = uv_async_init(loop, &slot->doneAsync, DoneCallback);
+        if (ret != 0) {
+            HILOG_ERROR("init completion handle of ordered queue failed, ret: %{public}d", ret);
+            queues_.erase(queueId);
+            return SerialEnqueueResult::FAILED;
+        }
+        slot->doneAsync.data = slot.get();
+        uv_unref(reinterpret_cast<uv_handle_t*>(&slot->doneAsync));
+    }
+    SerialQueue* queue = slot.get();
+    if (queue->backlog.size() >= MAX_BACKLOG) {
+        rejected_++;
+        return SerialEnqueueResult::BACKLOG_FULL;
+    }
+    queue->backlog.emplace_back(work, qos);
+    pending_++;
+    if (queue->draining) {
+        return SerialEnqueueResult::QUEUED;
+    }
+    if (StartDrain(queue) != 0) {
+        // an idle queue holds nothing but this work
+        queue->backlog.pop_back();
+        pending_--;
+        RemoveQueue(queueId);
+        return SerialEnqueueResult::FAILED;
+    }
+    return SerialEnqueueResult::QUEUED;
+}
+
+void NativeSerialExecutorRegistry::GetStats(NativeSerialExecutorStats& stats) const
+{
+    stats.activeQueues = queues_.size();
+    stats.pending = pending_;
+    stats.executed = executed_;
+    stats.rejected = rejected_;
+}
+
+void NativeSerialExecutorRegistry::RemoveQueue(uintptr_t queueId)
+{
+    auto iter = queues_.find(queueId);
+    if (iter == queues_.end()) {
+        return;
+    }
+    SerialQueue* queue = iter->second.release();
+    queues_.erase(iter);
+    CloseQueue(queue);
+}
+
+void NativeSerialExecutorRegistry::CloseQueue(SerialQueue* queue)
+{
+    uv_close(reinterpret_cast<uv_handle_t*>(&queue->doneAsync), [](uv_handle_t* handle) {
+        delete reinterpret_cast<SerialQueue*>(handle->data);
+    });
+}
+
+int NativeSerialExecutorRegistry::StartDrain(SerialQueue* queue)
+{
+    // a drain runs at one qos, a work of another qos waits for the next drain
+    napi_qos_t qos = queue->backlog.front().second;
+    while (!queue->backlog.empty() && queue->backlog.front().second == qos && queue->running.size() < DRAIN_BATCH) {
+        queue->running.push_back(queue->backlog.front().first);
+        queue->backlog.pop_front();
+    }
+    queue->completed = 0;
+    queue->draining = true;
+    int status = uv_queue_work_with_qos_internal(queue->loop, &queue->drainWork, DrainCallback, AfterDrainCallback,
+        uv_qos_t(qos), queue->running.front()->taskName_->c_str());
+    if (status != 0) {
+        HILOG_ERROR("queue drain of ordered queue failed, ret: %{public}d", status);
+        for (auto iter = queue->running.rbegin(); iter != queue->running.rend(); ++iter) {
+            queue->backlog.emplace_front(*iter, qos);
+        }
+        queue->running.clear();
+        queue->draining = false;
+    }
+    return status;
+}
+
+void NativeSerialExecutorRegistry::DrainCallback(uv_work_t* req)
+{
+    auto queue = reinterpret_cast<SerialQueue*>(req->data);
+    // the handle is closed on the loop only after this drain completes
+    for (auto work : queue->running) {
+        NativeAsyncWork::AsyncWorkCallback(&work->work_);
+        {
+            std::lock_guard<std::mutex> lock(queue->doneMutex);
+            queue->done.push_back(work);
+        }
+        uv_async_send(&queue->doneAsync);
+    }
+}
+
+void NativeSerialExecutorRegistry::DoneCallback(uv_async_t* handle)
+{
+    auto queue = reinterpret_cast<SerialQueue*>(handle->data);
+    if (queue->registry != nullptr) {
+        CompleteDone(queue);
+    }
+}
+
+void NativeSerialExecutorRegistry::CompleteDone(SerialQueue* queue)
+{
+    std::vector<NativeAsyncWork*> done;
+    {
+        std::lock_guard<std::mutex> lock(queue->doneMutex);
+        done.swap(queue->done);
+    }
+    auto registry = queue->registry;
+    registry->executed_ += done.size();
+    // complete callbacks may queue more works to this queue, they wait in the backlog until the next drain
+    for (auto work : done) {
+        queue->completed++;
+        registry->pending_--;
+        NativeAsyncWork::AsyncAfterWorkCallback(&work->work_, 0);
+    }
+}
+
+void NativeSerialExecutorRegistry::AfterDrainCallback(uv_work_t* req, int status)
+{
+    auto queue = reinterpret_cast<SerialQueue*>(req->data);
+    auto registry = queue->registry;
+    if (registry == nullptr) {
+        // the registry went away with its engine, the complete callbacks have no env to run in
+        CloseQueue(queue);
+        return;
+    }
+    // completions still waiting for the handle go first, then the works the drain never ran
+    CompleteDone(queue);
+    std::vector<NativeAsyncWork*> running;
+    running.swap(queue->running);
+    for (size_t i = queue->completed; i < running.size(); i++) {
+        registry->pending_--;
+        NativeAsyncWork::AsyncAfterWorkCallback(&running[i]->work_, status);
+    }
+    queue->draining = false;
+
+    if (!queue->backlog.empty()) {
+        int ret = registry->StartDrain(queue);
+        if (ret != 0) {
+            decltype(queue->backlog) failed;
+            failed.swap(queue->backlog);
+            for (auto& item : failed) {
+                registry->pending_--;
+                NativeAsyncWork::AsyncAfterWorkCallback(&item.first->work_, ret);
+            }
+        }
+    }
+    if (!queue->draining && queue->backlog.empty()) {
+        registry->RemoveQueue(queue->id);
+    }
+}
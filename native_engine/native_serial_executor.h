@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SERIAL_EXECUTOR_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SERIAL_EXECUTOR_H
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <uv.h>
+
+#include "interfaces/kits/napi/common.h"
+
+class NativeAsyncWork;
+
+struct NativeSerialExecutorStats {
+    size_t activeQueues = 0;
+    size_t pending = 0;
+    uint64_t executed = 0;
+    uint64_t rejected = 0;
+};
+
+enum class SerialEnqueueResult {
+    QUEUED,
+    BACKLOG_FULL,
+    FAILED,
+};
+
+// Serial executors of NativeAsyncWork::QueueOrdered, one per queue id, owned by the engine that owns the loop.
+// A queue has at most one drain in flight on the uv thread pool. The drain runs up to DRAIN_BATCH works of the same
+// qos back to back and posts each completion to the loop as soon as its work returns, the next drain starts once the
+// drain is done. Works of one queue run and complete FIFO while different queues run in parallel. An idle queue is
+// dropped from the registry.
+// Loop thread only.
+class NativeSerialExecutorRegistry {
+public:
+    static constexpr size_t MAX_BACKLOG = 1024;
+
+    NativeSerialExecutorRegistry() = default;
+    ~NativeSerialExecutorRegistry();
+
+    NativeSerialExecutorRegistry(const NativeSerialExecutorRegistry&) = delete;
+    NativeSerialExecutorRegistry& operator=(const NativeSerialExecutorRegistry&) = delete;
+
+    SerialEnqueueResult Enqueue(uv_loop_t* loop, uintptr_t queueId, napi_qos_t qos, NativeAsyncWork* work);
+    void GetStats(NativeSerialExecutorStats& stats) const;
+
+private:
+    static constexpr size_t DRAIN_BATCH = 8;
+
+    struct SerialQueue {
+        // null once the registry is destroyed while the drain is in flight
+        NativeSerialExecutorRegistry* registry = nullptr;
+        uv_loop_t* loop = nullptr;
+        uintptr_t id = 0;
+        uv_work_t drainWork {};
+        // unreferenced, the drain keeps the loop alive, frees the queue once closed
+        uv_async_t doneAsync {};
+        bool draining = false;
+        std::deque<std::pair<NativeAsyncWork*, napi_qos_t>> backlog;
+        // handed to the drain, only the drain touches it until the drain completes
+        std::vector<NativeAsyncWork*> running;
+        // works of running already completed on the loop
+        size_t completed = 0;
+        std::mutex doneMutex;
+        // executed by the drain, not completed yet
+        std::vector<NativeAsyncWork*> done;
+    };
+
+    int StartDrain(SerialQueue* queue);
+    void RemoveQueue(uintptr_t queueId);
+    static void CloseQueue(SerialQueue* queue);
+    static void DrainCallback(uv_work_t* req);
+    static void DoneCallback(uv_async_t* handle);
+    static void CompleteDone(SerialQueue* queue);
+    static void AfterDrainCallback(uv_work_t* req, int status);
+
+    std::unordered_map<uintptr_t, std::unique_ptr<SerialQueue>> queues_;
+    size_t pending_ {0};
+    uint64_t executed_ {0};
+    uint64_t rejected_ {0};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_SERIAL_EXECUTOR_H */
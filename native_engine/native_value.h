@@ -42,6 +42,8 @@ typedef void* (*DetachCallback)(NativeEngine* engine, void* value, void* hint);
 using ErrorPos = std::pair<uint32_t, uint32_t>;
 using NativeThreadSafeFunctionCallJs =
     void (*)(NativeEngine* env, napi_value js_callback, void* context, void* data);
+using NativeThreadSafeFunctionCallJsBatch =
+    void (*)(NativeEngine* env, napi_value js_callback, void* context, void** data, size_t count);
 
 struct NativeObjectInfo {
     static NativeObjectInfo* CreateNewInstance() { return new(std::nothrow) NativeObjectInfo(); }
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_work_stealing_pool.h"
+
+#include <limits>
+
+#include "utils/log.h"
+
+namespace {
+constexpr size_t INVALID_WORKER_INDEX = std::numeric_limits<size_t>::max();
+thread_local size_t g_currentWorkerIndex = INVALID_WORKER_INDEX;
+
+size_t QosToLane(napi_qos_t qos)
+{
+    switch (qos) {
+        case napi_qos_background:
+            return 0;
+        case napi_qos_utility:
+            return 1;
+        case napi_qos_user_initiated:
+            return 3; // 3: highest lane
+        case napi_qos_default:
+        default:
+            return 2; // 2: default lane
+    }
+}
+} // namespace
+
+NativeWorkStealingPool& NativeWorkStealingPool::GetInstance()
+{
+    static NativeWorkStealingPool instance;
+    return instance;
+}
+
+NativeWorkStealingPool::~NativeWorkStealingPool()
+{
+    Stop();
+}
+
+bool NativeWorkStealingPool::Start(size_t threadCount)
+{
+    std::lock_guard<std::mutex> lifecycleLock(lifecycleMutex_);
+    if (running_.load()) {
+        return true;
+    }
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+    }
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+    if (threadCount > MAX_THREAD_COUNT) {
+        HILOG_WARN("work stealing pool size %{public}zu is clamped to %{public}zu", threadCount, MAX_THREAD_COUNT);
+        threadCount = MAX_THREAD_COUNT;
+    }
+
+    std::unique_lock<std::shared_mutex> workersLock(workersMutex_);
+    for (size_t i = 0; i < threadCount; i++) {
+        workers_.emplace_back(std::make_unique<Worker>());
+    }
+    running_.store(true);
+    for (size_t i = 0; i < threadCount; i++) {
+        workers_[i]->thread = std::thread(&NativeWorkStealingPool::WorkerMain, this, i);
+    }
+    HILOG_INFO("work stealing pool started, size: %{public}zu", threadCount);
+    return true;
+}
+
+void NativeWorkStealingPool::Stop()
+{
+    std::lock_guard<std::mutex> lifecycleLock(lifecycleMutex_);
+    {
+        std::unique_lock<std::shared_mutex> workersLock(workersMutex_);
+        if (!running_.load()) {
+            return;
+        }
+        // no Submit is in flight now, and none will pass the running_ check afterwards
+        running_.store(false);
+    }
+    {
+        std::lock_guard<std::mutex> sleepLock(sleepMutex_);
+        sleepCondition_.notify_all();
+    }
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+    std::unique_lock<std::shared_mutex> workersLock(workersMutex_);
+    workers_.clear();
+    HILOG_INFO("work stealing pool stopped");
+}
+
+bool NativeWorkStealingPool::IsRunning() const
+{
+    return running_.load(std::memory_order_acquire);
+}
+
+size_t NativeWorkStealingPool::GetThreadCount() const
+{
+    std::shared_lock<std::shared_mutex> workersLock(workersMutex_);
+    return running_.load() ? workers_.size() : 0;
+}
+
+bool NativeWorkStealingPool::Submit(NativeWorkStealingTask task, napi_qos_t qos)
+{
+    if (task.run == nullptr) {
+        return false;
+    }
+    std::shared_lock<std::shared_mutex> workersLock(workersMutex_);
+    if (!running_.load() || workers_.empty()) {
+        return false;
+    }
+    size_t index = g_currentWorkerIndex;
+    if (index >= workers_.size()) {
+        index = nextWorker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+    }
+    // counted before the push, a worker may take the task before this call returns
+    pendingTasks_.fetch_add(1);
+    {
+        Worker& worker = *workers_[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.lanes[QosToLane(qos)].push_back(task);
+    }
+    // pairs with the sleepingWorkers_ increment in WorkerMain, one of both sides sees the other
+    if (sleepingWorkers_.load() > 0) {
+        std::lock_guard<std::mutex> sleepLock(sleepMutex_);
+        sleepCondition_.notify_one();
+    }
+    return true;
+}
+
+bool NativeWorkStealingPool::PopLocal(size_t index, NativeWorkStealingTask& task)
+{
+    Worker& worker = *workers_[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    for (size_t lane = QOS_LANE_COUNT; lane > 0; lane--) {
+        auto& tasks = worker.lanes[lane - 1];
+        if (!tasks.empty()) {
+            task = tasks.back();
+            tasks.pop_back();
+            pendingTasks_.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NativeWorkStealingPool::Steal(size_t index, NativeWorkStealingTask& task)
+{
+    size_t count = workers_.size();
+    for (size_t lane = QOS_LANE_COUNT; lane > 0; lane--) {
+        for (size_t offset = 1; offset < count; offset++) {
+            Worker& victim = *workers_[(index + offset) % count];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            auto& tasks = victim.lanes[lane - 1];
+            if (!tasks.empty()) {
+                task = tasks.front();
+                tasks.pop_front();
+                pendingTasks_.fetch_sub(1);
+                stolen_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void NativeWorkStealingPool::WorkerMain(size_t index)
+{
+    g_currentWorkerIndex = index;
+    NativeWorkStealingTask task;
+    while (true) {
+        if (PopLocal(index, task) || Steal(index, task)) {
+            task.run(task.data);
+            continue;
+        }
+        std::unique_lock<std::mutex> sleepLock(sleepMutex_);
+        sleepingWorkers_.fetch_add(1);
+        sleepCondition_.wait(sleepLock, [this]() { return pendingTasks_.load() > 0 || !running_.load(); });
+        sleepingWorkers_.fetch_sub(1);
+        if (!running_.load() && pendingTasks_.load() == 0) {
+            break;
+        }
+    }
+    g_currentWorkerIndex = INVALID_WORKER_INDEX;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_WORK_STEALING_POOL_H
+#define FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "interfaces/kits/napi/common.h"
+
+struct NativeWorkStealingTask {
+    void (*run)(void* data) = nullptr;
+    void* data = nullptr;
+};
+
+// Process-wide executor for NativeAsyncWork::QueueWithQos.
+// Every worker owns one deque per QoS lane. External submissions are spread round-robin, submissions made from a
+// worker stay on its own deque. A worker takes its newest task of the highest QoS first and, once its deques are
+// empty, steals the oldest task of the highest QoS from the other workers.
+class NativeWorkStealingPool {
+public:
+    static NativeWorkStealingPool& GetInstance();
+
+    // |threadCount| 0 starts one worker per core. Starting a running pool keeps its size.
+    bool Start(size_t threadCount);
+    // Runs the tasks already submitted, then joins the workers.
+    void Stop();
+    bool IsRunning() const;
+    size_t GetThreadCount() const;
+
+    // Thread safe, returns false when the pool is not running.
+    bool Submit(NativeWorkStealingTask task, napi_qos_t qos);
+
+    uint64_t GetStolenCount() const
+    {
+        return stolen_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t QOS_LANE_COUNT = 4;
+    static constexpr size_t MAX_THREAD_COUNT = 64;
+
+    struct Worker {
+        std::mutex mutex;
+        std::deque<NativeWorkStealingTask> lanes[QOS_LANE_COUNT];
+        std::thread thread;
+    };
+
+    NativeWorkStealingPool() = default;
+    ~NativeWorkStealingPool();
+    NativeWorkStealingPool(const NativeWorkStealingPool&) = delete;
+    NativeWorkStealingPool& operator=(const NativeWorkStealingPool&) = delete;
+
+    void WorkerMain(size_t index);
+    bool PopLocal(size_t index, NativeWorkStealingTask& task);
+    bool Steal(size_t index, NativeWorkStealingTask& task);
+
+    // serializes Start and Stop
+    std::mutex lifecycleMutex_;
+    // held shared by Submit so that Stop never releases workers_ under a producer
+    mutable std::shared_mutex workersMutex_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> running_ {false};
+    std::atomic<size_t> nextWorker_ {0};
+    std::atomic<size_t> pendingTasks_ {0};
+    std::atomic<size_t> sleepingWorkers_ {0};
+    std::atomic<uint64_t> stolen_ {0};
+    std::mutex sleepMutex_;
+    std::condition_variable sleepCondition_;
+};
+
+#endif /* FOUNDATION_ACE_NAPI_NATIVE_ENGINE_NATIVE_WORK_STEALING_POOL_H */
@@ -15,38 +15,128 @@
 
 #include "native_reference_manager.h"
 
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
+#include "native_engine/impl/ark/ark_hybrid_native_reference.h"
 #include "native_engine/impl/ark/ark_native_reference.h"
+#include "native_engine/impl/ark/ark_sendable_native_reference.h"
+#include "utils/log.h"
+
+static_assert(sizeof(ArkXRefNativeReference) <= sizeof(ArkNativeReference),
+              "xref references share the reference slab");
+
+NativeReferenceManager::NativeReferenceManager()
+    : referenceSlab_(new NativeReferenceSlab(sizeof(ArkNativeReference))),
+      sendableReferenceSlab_(new NativeReferenceSlab(sizeof(ArkSendableNativeReference)))
+{}
 
 NativeReferenceManager::~NativeReferenceManager()
 {
-    for (auto handler = references_; handler != nullptr; handler = references_) {
-        references_ = reinterpret_cast<ArkNativeReference*>(handler)->next_;
-        delete handler;
-    }
+    // runtime owned references die with the manager, their blocks are released with the chunks instead of
+    // going back to the free list one by one.
+    size_t abandoned = 0;
+    references_.Drain([&abandoned](NativeReference* handler) {
+        reinterpret_cast<ArkNativeReference*>(handler)->registryIndex_ = NativeReferenceRegistry::INVALID_INDEX;
+        handler->~NativeReference();
+        abandoned++;
+    });
+    // references still held by users keep the slabs alive until they are deleted
+    NativeReferenceSlab::Detach(referenceSlab_, abandoned);
+    NativeReferenceSlab::Detach(sendableReferenceSlab_, 0);
+    referenceSlab_ = nullptr;
+    sendableReferenceSlab_ = nullptr;
 }
 
 void NativeReferenceManager::CreateHandler(NativeReference* reference)
 {
-    if (references_) {
-        reinterpret_cast<ArkNativeReference*>(references_)->prev_ = reference;
-        reinterpret_cast<ArkNativeReference*>(reference)->next_ = references_;
-    }
-    references_ = reference;
+    reinterpret_cast<ArkNativeReference*>(reference)->registryIndex_ = references_.Insert(reference);
 }
 
 void NativeReferenceManager::ReleaseHandler(NativeReference* reference)
 {
-    NativeReference* prev = reinterpret_cast<ArkNativeReference*>(reference)->prev_;
-    NativeReference* next = reinterpret_cast<ArkNativeReference*>(reference)->next_;
+    auto arkReference = reinterpret_cast<ArkNativeReference*>(reference);
+    references_.Remove(arkReference->registryIndex_);
+    arkReference->registryIndex_ = NativeReferenceRegistry::INVALID_INDEX;
+}
 
-    if (prev) {
-        reinterpret_cast<ArkNativeReference*>(prev)->next_ = next;
+void NativeReferenceManager::GetFinalizerStats(std::vector<NativeReferenceFinalizerStats>& stats) const
+{
+    std::unordered_map<uintptr_t, NativeReferenceFinalizerStats> groups;
+    references_.ForEach([&groups](NativeReference* handler) {
+        auto reference = reinterpret_cast<ArkNativeReference*>(handler);
+        auto finalizer = reinterpret_cast<uintptr_t>(reference->napiCallback_);
+        NativeReferenceFinalizerStats& group = groups[finalizer];
+        group.finalizer = finalizer;
+        group.count++;
+        group.nativeBindingSize += reference->nativeBindingSize_;
+    });
+    stats.clear();
+    stats.reserve(groups.size());
+    for (const auto& group : groups) {
+        stats.emplace_back(group.second);
     }
-    if (reference == references_) {
-        // reference is the head node.
-        references_ = next;
+    std::sort(stats.begin(), stats.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.count != rhs.count ? lhs.count > rhs.count : lhs.finalizer < rhs.finalizer;
+    });
+}
+
+std::string NativeReferenceManager::DumpReferencesByFinalizer(size_t maxEntries) const
+{
+    std::vector<NativeReferenceFinalizerStats> stats;
+    GetFinalizerStats(stats);
+    std::ostringstream dump;
+    dump << "live references: " << references_.Size() << ", finalizers: " << stats.size() << "\n";
+    for (size_t i = 0; i < stats.size() && i < maxEntries; i++) {
+        dump << "  finalizer 0x" << std::hex << stats[i].finalizer << std::dec << ": count " << stats[i].count
+             << ", native binding size " << stats[i].nativeBindingSize << "\n";
     }
-    if (next) {
-        reinterpret_cast<ArkNativeReference*>(next)->prev_ = prev;
+    return dump.str();
+}
+
+void* NativeReferenceManager::AllocateReference(NativeReferenceManager* manager, size_t size)
+{
+    static NativeReferenceSlab* fallbackSlab = new NativeReferenceSlab(sizeof(ArkNativeReference));
+    NativeReferenceSlab* slab = manager != nullptr ? manager->referenceSlab_ : fallbackSlab;
+    if (size > slab->GetBlockSize()) {
+        HILOG_FATAL("reference size %{public}zu exceeds slab block size %{public}zu", size, slab->GetBlockSize());
+        return nullptr;
     }
+    return slab->Allocate();
+}
+
+size_t NativeReferenceManager::AllocateReferences(NativeReferenceManager* manager, size_t size, void** blocks,
+                                                  size_t count)
+{
+    if (manager == nullptr) {
+        size_t allocated = 0;
+        while (allocated < count && (blocks[allocated] = AllocateReference(nullptr, size)) != nullptr) {
+            allocated++;
+        }
+        return allocated;
+    }
+    if (size > manager->referenceSlab_->GetBlockSize()) {
+        HILOG_FATAL("reference size %{public}zu exceeds slab block size %{public}zu", size,
+                    manager->referenceSlab_->GetBlockSize());
+        return 0;
+    }
+    return manager->referenceSlab_->AllocateBatch(blocks, count);
+}
+
+void* NativeReferenceManager::AllocateSendableReference(NativeReferenceManager* manager, size_t size)
+{
+    static NativeReferenceSlab* fallbackSlab = new NativeReferenceSlab(sizeof(ArkSendableNativeReference));
+    NativeReferenceSlab* slab = manager != nullptr ? manager->sendableReferenceSlab_ : fallbackSlab;
+    if (size > slab->GetBlockSize()) {
+        HILOG_FATAL("reference size %{public}zu exceeds slab block size %{public}zu", size, slab->GetBlockSize());
+        return nullptr;
+    }
+    return slab->Allocate();
+}
+
+void NativeReferenceManager::GetMemoryStats(NativeReferenceMemoryStats& stats)
+{
+    referenceSlab_->GetStats(stats.references);
+    sendableReferenceSlab_->GetStats(stats.sendableReferences);
 }
@@ -16,18 +16,56 @@
 #ifndef FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_MANAGER_H
 #define FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_MANAGER_H
 
+#include <string>
+#include <vector>
+
 #include "native_engine/native_reference.h"
+#include "native_reference_registry.h"
+#include "native_reference_slab.h"
 #include "utils/macros.h"
 
+struct NativeReferenceMemoryStats {
+    NativeReferenceSlabStats references;
+    NativeReferenceSlabStats sendableReferences;
+};
+
+// Runtime owned references sharing one finalize callback.
+struct NativeReferenceFinalizerStats {
+    uintptr_t finalizer = 0;
+    size_t count = 0;
+    size_t nativeBindingSize = 0;
+};
+
 class NAPI_EXPORT NativeReferenceManager {
 public:
-    NativeReferenceManager() = default;
+    NativeReferenceManager();
     virtual ~NativeReferenceManager();
 
     void CreateHandler(NativeReference* reference);
     void ReleaseHandler(NativeReference* reference);
 
+    // Storage of ArkNativeReference and ArkSendableNativeReference objects. |manager| may be nullptr once the
+    // engine is torn down, a process-wide slab serves the allocation then. Blocks are freed by
+    // NativeReferenceSlab::Free.
+    static void* AllocateReference(NativeReferenceManager* manager, size_t size);
+    static void* AllocateSendableReference(NativeReferenceManager* manager, size_t size);
+    // |count| blocks for ArkNativeReference objects at once, returns how many were allocated.
+    static size_t AllocateReferences(NativeReferenceManager* manager, size_t size, void** blocks, size_t count);
+
+    void GetMemoryStats(NativeReferenceMemoryStats& stats);
+
+    size_t GetReferenceCount() const
+    {
+        return references_.Size();
+    }
+    // Groups the runtime owned references by finalize callback, largest group first.
+    void GetFinalizerStats(std::vector<NativeReferenceFinalizerStats>& stats) const;
+    // One line per finalize callback, at most |maxEntries| lines.
+    std::string DumpReferencesByFinalizer(size_t maxEntries) const;
+
 private:
-    NativeReference *references_ {nullptr};
+    NativeReferenceRegistry references_;
+    NativeReferenceSlab* referenceSlab_ {nullptr};
+    NativeReferenceSlab* sendableReferenceSlab_ {nullptr};
 };
 #endif /* FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_MANAGER_H */
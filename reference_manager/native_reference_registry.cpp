@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_reference_registry.h"
+
+#include <new>
+
+#include "utils/log.h"
+
+uint32_t NativeReferenceRegistry::Insert(NativeReference* reference)
+{
+    if (partialChunks_.empty()) {
+        if (chunks_.size() >= MAX_CHUNKS) {
+            HILOG_ERROR("reference registry is full");
+            return INVALID_INDEX;
+        }
+        std::unique_ptr<Chunk> chunk(new (std::nothrow) Chunk);
+        if (chunk == nullptr) {
+            HILOG_ERROR("failed to allocate reference registry chunk");
+            return INVALID_INDEX;
+        }
+        for (uint32_t word = 0; word < WORD_COUNT; word++) {
+            chunk->freeBits[word] = ~uint64_t(0);
+        }
+        chunk->used = 0;
+        chunk->hasFreeSlot = true;
+        partialChunks_.emplace_back(static_cast<uint32_t>(chunks_.size()));
+        chunks_.emplace_back(std::move(chunk));
+    }
+
+    uint32_t chunkIndex = partialChunks_.back();
+    Chunk& chunk = *chunks_[chunkIndex];
+    uint32_t word = 0;
+    while (chunk.freeBits[word] == 0) {
+        word++;
+    }
+    uint32_t bit = static_cast<uint32_t>(__builtin_ctzll(chunk.freeBits[word]));
+    chunk.freeBits[word] &= ~(uint64_t(1) << bit);
+    uint32_t slot = word * WORD_BITS + bit;
+    chunk.slots[slot] = reference;
+    if (++chunk.used == CHUNK_SIZE) {
+        chunk.hasFreeSlot = false;
+        partialChunks_.pop_back();
+    }
+    size_++;
+    return (chunkIndex << CHUNK_SHIFT) | slot;
+}
+
+NativeReference* NativeReferenceRegistry::Remove(uint32_t index)
+{
+    uint32_t chunkIndex = index >> CHUNK_SHIFT;
+    if (index == INVALID_INDEX || chunkIndex >= chunks_.size()) {
+        return nullptr;
+    }
+    Chunk& chunk = *chunks_[chunkIndex];
+    uint32_t slot = index & (CHUNK_SIZE - 1);
+    uint64_t mask = uint64_t(1) << (slot % WORD_BITS);
+    uint64_t& bits = chunk.freeBits[slot / WORD_BITS];
+    if ((bits & mask) != 0) {
+        return nullptr;
+    }
+    bits |= mask;
+    NativeReference* reference = chunk.slots[slot];
+    chunk.slots[slot] = nullptr;
+    chunk.used--;
+    if (!chunk.hasFreeSlot) {
+        chunk.hasFreeSlot = true;
+        partialChunks_.emplace_back(chunkIndex);
+    }
+    size_--;
+    return reference;
+}
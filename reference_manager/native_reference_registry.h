@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_REGISTRY_H
+#define FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_REGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "native_engine/native_reference.h"
+
+// Index-based set of references.
+// Entries live in chunks of CHUNK_SIZE slots with a bitmap of free slots, an entry is addressed by a 32-bit index
+// (chunk << CHUNK_SHIFT | slot) that the caller keeps instead of list pointers. Insert takes a slot of the newest
+// chunk that has one, Remove frees it, both without touching other entries. Not thread safe.
+class NativeReferenceRegistry {
+public:
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    NativeReferenceRegistry() = default;
+    ~NativeReferenceRegistry() = default;
+
+    NativeReferenceRegistry(const NativeReferenceRegistry&) = delete;
+    NativeReferenceRegistry& operator=(const NativeReferenceRegistry&) = delete;
+
+    // Returns INVALID_INDEX when out of memory.
+    uint32_t Insert(NativeReference* reference);
+    // Returns the entry at |index|, nullptr when the slot is already free.
+    NativeReference* Remove(uint32_t index);
+
+    size_t Size() const
+    {
+        return size_;
+    }
+
+    // Visits live entries in index order, |visitor| must not insert or remove.
+    template<typename Visitor>
+    void ForEach(Visitor&& visitor) const
+    {
+        for (const auto& chunk : chunks_) {
+            for (uint32_t word = 0; word < WORD_COUNT; word++) {
+                uint64_t used = ~chunk->freeBits[word];
+                while (used != 0) {
+                    uint32_t bit = static_cast<uint32_t>(__builtin_ctzll(used));
+                    used &= used - 1;
+                    visitor(chunk->slots[word * WORD_BITS + bit]);
+                }
+            }
+        }
+    }
+
+    // Removes every entry and hands it to |visitor|, which may remove or insert other entries meanwhile.
+    template<typename Visitor>
+    void Drain(Visitor&& visitor)
+    {
+        while (size_ > 0) {
+            for (uint32_t chunk = 0; chunk < chunks_.size(); chunk++) {
+                for (uint32_t word = 0; word < WORD_COUNT; word++) {
+                    uint64_t used = 0;
+                    while ((used = ~chunks_[chunk]->freeBits[word]) != 0) {
+                        uint32_t slot = word * WORD_BITS + static_cast<uint32_t>(__builtin_ctzll(used));
+                        visitor(Remove((chunk << CHUNK_SHIFT) | slot));
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    static constexpr uint32_t CHUNK_SHIFT = 10;
+    static constexpr uint32_t CHUNK_SIZE = 1u << CHUNK_SHIFT;
+    static constexpr uint32_t WORD_BITS = 64;
+    static constexpr uint32_t WORD_COUNT = CHUNK_SIZE / WORD_BITS;
+    static constexpr uint32_t MAX_CHUNKS = INVALID_INDEX >> CHUNK_SHIFT;
+
+    struct Chunk {
+        NativeReference* slots[CHUNK_SIZE];
+        // a set bit marks a free slot
+        uint64_t freeBits[WORD_COUNT];
+        uint32_t used;
+        bool hasFreeSlot;
+    };
+
+    std::vector<std::unique_ptr<Chunk>> chunks_;
+    // chunks with at least one free slot, Insert takes from the back
+    std::vector<uint32_t> partialChunks_;
+    size_t size_ {0};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_REGISTRY_H */
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_reference_slab.h"
+
+#include <cstdint>
+#include <new>
+
+#include "utils/log.h"
+
+namespace {
+constexpr size_t BLOCK_ALIGN = alignof(std::max_align_t);
+
+constexpr size_t AlignUp(size_t size)
+{
+    return (size + BLOCK_ALIGN - 1) & ~(BLOCK_ALIGN - 1);
+}
+} // namespace
+
+NativeReferenceSlab::NativeReferenceSlab(size_t blockSize)
+    : blockSize_(AlignUp(blockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : blockSize)),
+      blocksPerChunk_((CHUNK_SIZE - AlignUp(sizeof(ChunkHeader))) / blockSize_)
+{}
+
+NativeReferenceSlab::~NativeReferenceSlab()
+{
+    for (ChunkHeader* chunk : chunks_) {
+        ::operator delete(chunk, std::align_val_t(CHUNK_SIZE));
+    }
+}
+
+bool NativeReferenceSlab::AddChunk()
+{
+    void* memory = ::operator new(CHUNK_SIZE, std::align_val_t(CHUNK_SIZE), std::nothrow);
+    if (memory == nullptr) {
+        HILOG_ERROR("failed to allocate reference chunk, block size: %{public}zu", blockSize_);
+        return false;
+    }
+    auto chunk = new (memory) ChunkHeader {this, nullptr, 0, 0, chunks_.size(), nullptr, nullptr, false};
+    chunks_.emplace_back(chunk);
+    current_ = chunk;
+    return true;
+}
+
+void NativeReferenceSlab::PushPartial(ChunkHeader* chunk)
+{
+    chunk->partial = true;
+    chunk->prevPartial = nullptr;
+    chunk->nextPartial = partialChunks_;
+    if (partialChunks_ != nullptr) {
+        partialChunks_->prevPartial = chunk;
+    }
+    partialChunks_ = chunk;
+}
+
+void NativeReferenceSlab::RemovePartial(ChunkHeader* chunk)
+{
+    if (chunk->prevPartial != nullptr) {
+        chunk->prevPartial->nextPartial = chunk->nextPartial;
+    } else {
+        partialChunks_ = chunk->nextPartial;
+    }
+    if (chunk->nextPartial != nullptr) {
+        chunk->nextPartial->prevPartial = chunk->prevPartial;
+    }
+    chunk->partial = false;
+}
+
+void* NativeReferenceSlab::AllocateLocked()
+{
+    if (current_ == nullptr || IsFull(current_)) {
+        if (partialChunks_ != nullptr) {
+            current_ = partialChunks_;
+            RemovePartial(current_);
+        } else if (!AddChunk()) {
+            return nullptr;
+        }
+    }
+    ChunkHeader* chunk = current_;
+    void* block = chunk->freeList;
+    if (block != nullptr) {
+        chunk->freeList = chunk->freeList->next;
+    } else {
+        block = reinterpret_cast<char*>(chunk) + AlignUp(sizeof(ChunkHeader)) + chunk->used * blockSize_;
+        chunk->used++;
+    }
+    chunk->live++;
+    liveBlocks_++;
+    return block;
+}
+
+void* NativeReferenceSlab::Allocate()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return AllocateLocked();
+}
+
+size_t NativeReferenceSlab::AllocateBatch(void** blocks, size_t count)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t allocated = 0;
+    while (allocated < count) {
+        void* block = AllocateLocked();
+        if (block == nullptr) {
+            break;
+        }
+        blocks[allocated++] = block;
+    }
+    return allocated;
+}
+
+void NativeReferenceSlab::FreeLocked(ChunkHeader* chunk, FreeBlock* block)
+{
+    bool wasFull = IsFull(chunk);
+    block->next = chunk->freeList;
+    chunk->freeList = block;
+    chunk->live--;
+    if (chunk == current_ || detached_) {
+        return;
+    }
+    if (chunk->live == 0) {
+        if (chunk->partial) {
+            RemovePartial(chunk);
+        }
+        ChunkHeader* last = chunks_.back();
+        chunks_[chunk->index] = last;
+        last->index = chunk->index;
+        chunks_.pop_back();
+        ::operator delete(chunk, std::align_val_t(CHUNK_SIZE));
+    } else if (wasFull) {
+        PushPartial(chunk);
+    }
+}
+
+void NativeReferenceSlab::Free(void* block)
+{
+    if (block == nullptr) {
+        return;
+    }
+    auto chunk = reinterpret_cast<ChunkHeader*>(reinterpret_cast<uintptr_t>(block) & ~(CHUNK_SIZE - 1));
+    NativeReferenceSlab* slab = chunk->slab;
+    bool release = false;
+    {
+        std::lock_guard<std::mutex> lock(slab->mutex_);
+        slab->FreeLocked(chunk, static_cast<FreeBlock*>(block));
+        release = slab->Release(1);
+    }
+    if (release) {
+        delete slab;
+    }
+}
+
+void NativeReferenceSlab::Detach(NativeReferenceSlab* slab, size_t abandonedBlocks)
+{
+    if (slab == nullptr) {
+        return;
+    }
+    bool release = false;
+    {
+        std::lock_guard<std::mutex> lock(slab->mutex_);
+        slab->detached_ = true;
+        release = slab->Release(abandonedBlocks);
+        if (!release) {
+            HILOG_DEBUG("reference slab detached with %{public}zu live blocks", slab->liveBlocks_);
+        }
+    }
+    if (release) {
+        delete slab;
+    }
+}
+
+bool NativeReferenceSlab::Release(size_t count)
+{
+    liveBlocks_ = count < liveBlocks_ ? liveBlocks_ - count : 0;
+    return detached_ && liveBlocks_ == 0;
+}
+
+void NativeReferenceSlab::GetStats(NativeReferenceSlabStats& stats)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.liveBlocks = liveBlocks_;
+    stats.freeBlocks = chunks_.size() * blocksPerChunk_ - liveBlocks_;
+    stats.chunks = chunks_.size();
+    stats.reservedBytes = chunks_.size() * CHUNK_SIZE;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_SLAB_H
+#define FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_SLAB_H
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+struct NativeReferenceSlabStats {
+    size_t liveBlocks = 0;
+    size_t freeBlocks = 0;
+    size_t chunks = 0;
+    size_t reservedBytes = 0;
+};
+
+// Fixed-size block allocator for reference objects.
+// Blocks are carved out of CHUNK_SIZE chunks aligned to CHUNK_SIZE, the chunk header names the owning slab, so a
+// block is freed without knowing where it came from and without a per-block header. Each chunk keeps its own free
+// list, freed blocks are reused LIFO from the chunk allocations are served from, then from other chunks with free
+// blocks. A chunk is released once all its blocks are free, except the current one.
+// A slab outlives its owner while blocks are still in use: Detach hands it over to the last Free, the abandoned
+// blocks are not counted per chunk so the remaining chunks go together with the slab.
+class NativeReferenceSlab {
+public:
+    explicit NativeReferenceSlab(size_t blockSize);
+
+    NativeReferenceSlab(const NativeReferenceSlab&) = delete;
+    NativeReferenceSlab& operator=(const NativeReferenceSlab&) = delete;
+
+    // Thread safe, returns nullptr when out of memory.
+    void* Allocate();
+    // Thread safe, fills |blocks| under one lock, freed blocks first, then consecutive never used ones. Returns how
+    // many were allocated, less than |count| only when out of memory.
+    size_t AllocateBatch(void** blocks, size_t count);
+    // Thread safe, |block| may come from any slab.
+    static void Free(void* block);
+    // Called by the owner instead of delete. |abandonedBlocks| were destroyed in place by the owner and are not
+    // freed one by one, their memory goes with the chunks.
+    static void Detach(NativeReferenceSlab* slab, size_t abandonedBlocks);
+
+    size_t GetBlockSize() const
+    {
+        return blockSize_;
+    }
+    void GetStats(NativeReferenceSlabStats& stats);
+
+private:
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct ChunkHeader {
+        NativeReferenceSlab* slab;
+        FreeBlock* freeList;
+        // blocks handed out once at least, the others follow them unused
+        size_t used;
+        size_t live;
+        // position in chunks_
+        size_t index;
+        // links of partialChunks_
+        ChunkHeader* prevPartial;
+        ChunkHeader* nextPartial;
+        bool partial;
+    };
+
+    ~NativeReferenceSlab();
+    bool AddChunk();
+    void* AllocateLocked();
+    bool IsFull(const ChunkHeader* chunk) const
+    {
+        return chunk->freeList == nullptr && chunk->used == blocksPerChunk_;
+    }
+    void PushPartial(ChunkHeader* chunk);
+    void RemovePartial(ChunkHeader* chunk);
+    void FreeLocked(ChunkHeader* chunk, FreeBlock* block);
+    // Returns true when the detached slab has no live block left and must be deleted by the caller.
+    bool Release(size_t count);
+
+    const size_t blockSize_;
+    const size_t blocksPerChunk_;
+    std::mutex mutex_;
+    std::vector<ChunkHeader*> chunks_;
+    // the chunk allocations are served from, kept even when empty
+    ChunkHeader* current_ {nullptr};
+    // other chunks with free blocks
+    ChunkHeader* partialChunks_ {nullptr};
+    size_t liveBlocks_ {0};
+    bool detached_ {false};
+};
+
+#endif /* FOUNDATION_ACE_NAPI_REFERENCE_MANAGER_NATIVE_REFERENCE_SLAB_H */
@@ -23,11 +23,13 @@
 #include <thread>
 
 #include "ark_native_reference.h"
+#include "ark_native_weak_table.h"
 #include "gtest/gtest.h"
 #include "hilog/log.h"
 #include "ecmascript/napi/include/jsnapi_expo.h"
 #include "napi/native_common.h"
 #include "napi/native_node_api.h"
+#include "napi/native_node_binding.h"
 #include "napi/native_node_hybrid_api.h"
 #include "native_create_env.h"
 #include "native_utils.h"
@@ -2744,6 +2746,263 @@ HWTEST_F(NapiBasicTest, AsyncWorkTestAddTaskname003, testing::ext::TestSize.Leve
     RUN_EVENT_LOOP(env);
 }
 
+/**
+ * @tc.name: AsyncWorkCacheTest001
+ * @tc.desc: Test async works reuse the storage of deleted works and share interned names.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkCacheTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    auto execute = [](napi_env env, void* data) {};
+    auto complete = [](napi_env env, napi_status status, void* data) {};
+
+    napi_async_work first = nullptr;
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName, execute, complete, nullptr, &first));
+    ASSERT_CHECK_CALL(napi_delete_async_work(env, first));
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    ASSERT_CHECK_CALL(napi_get_async_work_cache_stats(env, &hits, &misses));
+
+    for (int i = 0; i < ASYNC_WORK_NUM; ++i) {
+        napi_async_work work = nullptr;
+        ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName, execute, complete, nullptr, &work));
+        EXPECT_EQ(work, first);
+        EXPECT_EQ(reinterpret_cast<NativeAsyncWork*>(work)->GetTaskName(), std::string(TEST_CHAR_ASYNCWORK));
+        ASSERT_CHECK_CALL(napi_delete_async_work(env, work));
+    }
+    uint64_t newHits = 0;
+    uint64_t newMisses = 0;
+    ASSERT_CHECK_CALL(napi_get_async_work_cache_stats(env, &newHits, &newMisses));
+    EXPECT_EQ(newHits - hits, static_cast<uint64_t>(ASYNC_WORK_NUM));
+    EXPECT_EQ(newMisses, misses);
+}
+
+/**
+ * @tc.name: AsyncWorkCacheTest002
+ * @tc.desc: Test interface of napi_get_async_work_cache_stats
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkCacheTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    ASSERT_EQ(napi_get_async_work_cache_stats(nullptr, &hits, &misses), napi_invalid_arg);
+    ASSERT_EQ(napi_get_async_work_cache_stats(env, nullptr, &misses), napi_invalid_arg);
+    ASSERT_EQ(napi_get_async_work_cache_stats(env, &hits, nullptr), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: AsyncWorkBatchTest001
+ * @tc.desc: Test napi_queue_async_work_batch runs every item and completes once on the loop thread.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkBatchTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t batchSize = 64;
+    struct BatchContext {
+        int values[batchSize] = {0};
+        int completeCount = 0;
+        std::thread::id jsThread;
+    };
+    napi_env env = (napi_env)engine_;
+    BatchContext context;
+    context.jsThread = std::this_thread::get_id();
+    void* items[batchSize] = {nullptr};
+    for (size_t i = 0; i < batchSize; ++i) {
+        items[i] = &context.values[i];
+    }
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    ASSERT_CHECK_CALL(napi_queue_async_work_batch(env, resourceName,
+        [](napi_env env, void* data) { *reinterpret_cast<int*>(data) += 1; },
+        items, batchSize,
+        [](napi_env env, napi_status status, void* data) {
+            auto context = reinterpret_cast<BatchContext*>(data);
+            EXPECT_EQ(status, napi_ok);
+            EXPECT_EQ(std::this_thread::get_id(), context->jsThread);
+            context->completeCount++;
+            STOP_EVENT_LOOP(env);
+        },
+        &context, napi_qos_default));
+    RUN_EVENT_LOOP(env);
+    EXPECT_EQ(context.completeCount, INT_ONE);
+    for (size_t i = 0; i < batchSize; ++i) {
+        EXPECT_EQ(context.values[i], INT_ONE);
+    }
+}
+
+/**
+ * @tc.name: AsyncWorkBatchTest002
+ * @tc.desc: Test interface of napi_queue_async_work_batch
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkBatchTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    auto execute = [](napi_env env, void* data) {};
+    auto complete = [](napi_env env, napi_status status, void* data) {};
+    void* items[INT_ONE] = {nullptr};
+    ASSERT_EQ(napi_queue_async_work_batch(nullptr, resourceName, execute, items, INT_ONE, complete, nullptr,
+        napi_qos_default), napi_invalid_arg);
+    ASSERT_EQ(napi_queue_async_work_batch(env, resourceName, nullptr, items, INT_ONE, complete, nullptr,
+        napi_qos_default), napi_invalid_arg);
+    ASSERT_EQ(napi_queue_async_work_batch(env, resourceName, execute, nullptr, INT_ONE, complete, nullptr,
+        napi_qos_default), napi_invalid_arg);
+    ASSERT_EQ(napi_queue_async_work_batch(env, resourceName, execute, items, 0, complete, nullptr,
+        napi_qos_default), napi_invalid_arg);
+    ASSERT_EQ(napi_queue_async_work_batch(env, resourceName, execute, items, INT_ONE, nullptr, nullptr,
+        napi_qos_default), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: AsyncWorkDeadlineTest001
+ * @tc.desc: Test a work that has not started before its deadline completes with napi_cancelled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkDeadlineTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr int blockMs = 50;
+    struct DeadlineContext {
+        napi_async_work blocker = nullptr;
+        napi_async_work work = nullptr;
+        bool executed = false;
+        napi_status status = napi_ok;
+        int completed = 0;
+    };
+    UVLoopRunner runner(engine_);
+    napi_env env = (napi_env)engine_;
+    DeadlineContext context;
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    // a single worker busy with the blocker keeps the second work from starting in time
+    ASSERT_CHECK_CALL(napi_start_async_work_pool(env, INT_ONE));
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+        [](napi_env env, void* data) { std::this_thread::sleep_for(std::chrono::milliseconds(blockMs)); },
+        [](napi_env env, napi_status status, void* data) {
+            reinterpret_cast<DeadlineContext*>(data)->completed++;
+        },
+        &context, &context.blocker));
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+        [](napi_env env, void* data) { reinterpret_cast<DeadlineContext*>(data)->executed = true; },
+        [](napi_env env, napi_status status, void* data) {
+            auto context = reinterpret_cast<DeadlineContext*>(data);
+            context->status = status;
+            context->completed++;
+        },
+        &context, &context.work));
+    ASSERT_CHECK_CALL(napi_queue_async_work_with_qos(env, context.blocker, napi_qos_default));
+    ASSERT_CHECK_CALL(napi_queue_async_work_with_deadline(env, context.work, napi_qos_default, INT_ONE));
+    runner.Run();
+
+    EXPECT_EQ(context.completed, INT_TWO);
+    EXPECT_FALSE(context.executed);
+    EXPECT_EQ(context.status, napi_cancelled);
+    ASSERT_CHECK_CALL(napi_stop_async_work_pool(env));
+    napi_delete_async_work(env, context.blocker);
+    napi_delete_async_work(env, context.work);
+}
+
+/**
+ * @tc.name: AsyncWorkDeadlineTest002
+ * @tc.desc: Test a running execute callback observes napi_cancel_async_work through its token.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkDeadlineTest002, testing::ext::TestSize.Level1)
+{
+    struct TokenContext {
+        napi_env env = nullptr;
+        napi_async_work work = nullptr;
+        std::atomic<bool> started {false};
+        bool sawCancel = false;
+        napi_status status = napi_generic_failure;
+    };
+    UVLoopRunner runner(engine_);
+    napi_env env = (napi_env)engine_;
+    TokenContext context;
+    context.env = env;
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+        [](napi_env env, void* data) {
+            auto context = reinterpret_cast<TokenContext*>(data);
+            context->started = true;
+            bool cancelled = false;
+            while (!cancelled) {
+                napi_is_async_work_cancelled(context->env, context->work, &cancelled);
+                std::this_thread::yield();
+            }
+            context->sawCancel = cancelled;
+        },
+        [](napi_env env, napi_status status, void* data) {
+            reinterpret_cast<TokenContext*>(data)->status = status;
+        },
+        &context, &context.work));
+    ASSERT_CHECK_CALL(napi_queue_async_work_with_qos(env, context.work, napi_qos_default));
+    while (!context.started) {
+        std::this_thread::yield();
+    }
+    // too late to skip the work, the token still tells it to stop
+    EXPECT_EQ(napi_cancel_async_work(env, context.work), napi_generic_failure);
+    runner.Run();
+
+    EXPECT_TRUE(context.sawCancel);
+    // the work had started, it completes normally
+    EXPECT_EQ(context.status, napi_ok);
+    napi_delete_async_work(env, context.work);
+}
+
+/**
+ * @tc.name: AsyncWorkDeadlineTest003
+ * @tc.desc: Test interface of napi_queue_async_work_with_deadline and napi_is_async_work_cancelled
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkDeadlineTest003, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    napi_async_work work = nullptr;
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName, [](napi_env env, void* data) {},
+        [](napi_env env, napi_status status, void* data) {}, nullptr, &work));
+    bool cancelled = true;
+    ASSERT_EQ(napi_queue_async_work_with_deadline(nullptr, work, napi_qos_default, INT_ONE), napi_invalid_arg);
+    ASSERT_EQ(napi_queue_async_work_with_deadline(env, nullptr, napi_qos_default, INT_ONE), napi_invalid_arg);
+    ASSERT_EQ(napi_queue_async_work_with_deadline(env, work, napi_qos_default, 0), napi_invalid_arg);
+    ASSERT_EQ(napi_is_async_work_cancelled(env, nullptr, &cancelled), napi_invalid_arg);
+    ASSERT_EQ(napi_is_async_work_cancelled(env, work, nullptr), napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_is_async_work_cancelled(env, work, &cancelled));
+    ASSERT_FALSE(cancelled);
+    napi_delete_async_work(env, work);
+}
+
+/**
+ * @tc.name: AsyncWorkDeadlineTest004
+ * @tc.desc: Test a timeout too long for the clock never expires
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncWorkDeadlineTest004, testing::ext::TestSize.Level1)
+{
+    UVLoopRunner runner(engine_);
+    napi_env env = (napi_env)engine_;
+    napi_value resourceName = nullptr;
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName));
+    napi_status status = napi_generic_failure;
+    napi_async_work work = nullptr;
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName, [](napi_env env, void* data) {},
+        [](napi_env env, napi_status status, void* data) { *reinterpret_cast<napi_status*>(data) = status; },
+        &status, &work));
+    ASSERT_CHECK_CALL(napi_queue_async_work_with_deadline(env, work, napi_qos_default, UINT64_MAX));
+    runner.Run();
+    EXPECT_EQ(status, napi_ok);
+    napi_delete_async_work(env, work);
+}
+
 /**
  * @tc.name: ObjectWrapperTest001
  * @tc.desc: Test object wrapper.
@@ -2896,6 +3155,228 @@ HWTEST_F(NapiBasicTest, ObjectWrapperTest005, testing::ext::TestSize.Level1)
     ASSERT_EQ(napi_wrap_async_finalizer(engine, object, data1, finalizer, nullptr, nullptr, sizeof(data0)), napi_ok);
 }
 
+/**
+ * @tc.name: ConcurrentFinalizerTest001
+ * @tc.desc: Test interface of napi_wrap_concurrent_finalizer and napi_get_finalizer_stats
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ConcurrentFinalizerTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    auto finalizer = [](napi_env, void* data, void*) {
+        delete reinterpret_cast<uint8_t*>(data);
+    };
+    uint8_t* data = new uint8_t;
+    EXPECT_EQ(napi_wrap_concurrent_finalizer(nullptr, object, data, finalizer, nullptr, nullptr, 0), napi_invalid_arg);
+    EXPECT_EQ(napi_wrap_concurrent_finalizer(env, nullptr, data, finalizer, nullptr, nullptr, 0), napi_invalid_arg);
+    EXPECT_EQ(napi_wrap_concurrent_finalizer(env, object, nullptr, finalizer, nullptr, nullptr, 0), napi_invalid_arg);
+
+    napi_ref ref = nullptr;
+    ASSERT_CHECK_CALL(napi_wrap_concurrent_finalizer(env, object, data, finalizer, nullptr, &ref, sizeof(uint8_t)));
+    ASSERT_NE(ref, nullptr);
+    void* result = nullptr;
+    ASSERT_CHECK_CALL(napi_unwrap(env, object, &result));
+    EXPECT_EQ(result, data);
+    ASSERT_CHECK_CALL(napi_delete_reference(env, ref));
+
+    napi_finalizer_stats stats;
+    EXPECT_EQ(napi_get_finalizer_stats(nullptr, &stats), napi_invalid_arg);
+    EXPECT_EQ(napi_get_finalizer_stats(env, nullptr), napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_get_finalizer_stats(env, &stats));
+    EXPECT_LE(stats.last_pack_us, stats.max_pack_us);
+    EXPECT_LE(stats.max_pack_us, stats.total_pack_us);
+}
+
+/**
+ * @tc.name: ConcurrentFinalizerTest002
+ * @tc.desc: Test finalizer packs and concurrent shards record their timing
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ConcurrentFinalizerTest002, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t count = 3;
+    static size_t finalized = 0;
+    finalized = 0;
+    NapiNativeFinalize callback = [](napi_env, void*, void*) { finalized++; };
+    ArkFinalizersStats stats;
+
+    ArkFinalizersPack pack;
+    for (size_t i = 0; i < count; i++) {
+        RefFinalizer finalizer(callback, std::make_tuple(engine_, nullptr, nullptr));
+        pack.AddFinalizer(finalizer, 1);
+    }
+    size_t notifiedBindingSize = 0;
+    pack.RegisterFinishNotify([&stats, &notifiedBindingSize](size_t bindingSize, size_t num, uint64_t durationUs) {
+        notifiedBindingSize = bindingSize;
+        stats.RecordPack(num, durationUs);
+    });
+    pack.ProcessAll();
+    EXPECT_EQ(finalized, count);
+    EXPECT_EQ(notifiedBindingSize, count);
+    EXPECT_EQ(stats.packs.load(), 1U);
+    EXPECT_EQ(stats.finalizers.load(), count);
+    EXPECT_EQ(stats.lastPackUs.load(), stats.maxPackUs.load());
+
+    std::vector<RefAsyncFinalizer> finalizers(count, RefAsyncFinalizer(callback, std::make_pair(nullptr, nullptr)));
+    ArkNativeEngine::RunConcurrentCallbacks(&finalizers, &stats);
+    EXPECT_EQ(finalized, count * 2);
+    EXPECT_EQ(stats.concurrentShards.load(), 1U);
+    EXPECT_EQ(stats.concurrentFinalizers.load(), count);
+}
+
+/**
+ * @tc.name: AsyncFinalizerQueueTest001
+ * @tc.desc: Test async finalizers run batch by batch on the thread pool and on the JS thread when behind
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncFinalizerQueueTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t count = ArkAsyncFinalizerQueue::BATCH_SIZE * 2 + 1;
+    static std::atomic<size_t> finalized {0};
+    finalized = 0;
+    NapiNativeFinalize callback = [](napi_env, void*, void*) { finalized++; };
+    auto stats = std::make_shared<ArkFinalizersStats>();
+    auto queue = std::make_shared<ArkAsyncFinalizerQueue>(stats);
+    std::vector<RefAsyncFinalizer> finalizers(count, RefAsyncFinalizer(callback, std::make_pair(nullptr, nullptr)));
+    size_t capacity = finalizers.capacity();
+
+    uv_loop_t* loop = engine_->GetUVLoop();
+    EXPECT_EQ(queue->Enqueue(loop, finalizers), count);
+    EXPECT_TRUE(finalizers.empty());
+    EXPECT_EQ(finalizers.capacity(), capacity);
+    EXPECT_TRUE(queue->RunBatch(true));
+    static constexpr int maxRounds = 5000;
+    for (int i = 0; i < maxRounds && stats->asyncFinalizers.load() < count; i++) {
+        uv_run(loop, UV_RUN_NOWAIT);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    uv_run(loop, UV_RUN_NOWAIT);
+    EXPECT_EQ(finalized, count);
+    EXPECT_EQ(queue->GetBacklog(), 0U);
+    EXPECT_FALSE(queue->RunBatch(true));
+    EXPECT_EQ(stats->asyncBatches.load(), 3U);
+    EXPECT_EQ(stats->asyncFinalizers.load(), count);
+    EXPECT_EQ(stats->asyncSyncBatches.load(), 1U);
+    EXPECT_EQ(stats->asyncBacklog.load(), 0U);
+}
+
+/**
+ * @tc.name: AsyncFinalizerQueueTest002
+ * @tc.desc: Test a burst of async finalizers keeps several batches in flight on the thread pool
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, AsyncFinalizerQueueTest002, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t batches = ArkAsyncFinalizerQueue::MAX_IN_FLIGHT * 2;
+    static constexpr size_t count = ArkAsyncFinalizerQueue::BATCH_SIZE * batches;
+    static std::atomic<size_t> finalized {0};
+    finalized = 0;
+    NapiNativeFinalize callback = [](napi_env, void*, void*) { finalized++; };
+    auto stats = std::make_shared<ArkFinalizersStats>();
+    auto queue = std::make_shared<ArkAsyncFinalizerQueue>(stats);
+    std::vector<RefAsyncFinalizer> finalizers(count, RefAsyncFinalizer(callback, std::make_pair(nullptr, nullptr)));
+
+    uv_loop_t* loop = engine_->GetUVLoop();
+    EXPECT_EQ(queue->Enqueue(loop, finalizers), count);
+    // the after_work of a batch runs on the loop, nothing has been replaced yet
+    EXPECT_EQ(queue->GetInFlight(), ArkAsyncFinalizerQueue::MAX_IN_FLIGHT);
+    static constexpr int maxRounds = 5000;
+    for (int i = 0; i < maxRounds && stats->asyncFinalizers.load() < count; i++) {
+        uv_run(loop, UV_RUN_NOWAIT);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    for (int i = 0; i < maxRounds && queue->GetInFlight() > 0; i++) {
+        uv_run(loop, UV_RUN_NOWAIT);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(finalized, count);
+    EXPECT_EQ(queue->GetInFlight(), 0U);
+    EXPECT_EQ(stats->asyncBatches.load(), batches);
+    EXPECT_EQ(stats->asyncSyncBatches.load(), 0U);
+}
+
+/**
+ * @tc.name: FinalizersSliceTest001
+ * @tc.desc: Test finalizer packs run slice by slice and notify once when done
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, FinalizersSliceTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t count = 10;
+    static size_t finalized = 0;
+    finalized = 0;
+    NapiNativeFinalize callback = [](napi_env, void*, void*) { finalized++; };
+    ArkFinalizersPack pack;
+    for (size_t i = 0; i < count; i++) {
+        RefFinalizer finalizer(callback, std::make_tuple(engine_, nullptr, nullptr));
+        pack.AddFinalizer(finalizer, 1);
+    }
+    size_t notified = 0;
+    pack.RegisterFinishNotify([&notified](size_t, size_t num, uint64_t) { notified += num; });
+
+    EXPECT_FALSE(pack.ProcessSlice(4, std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(finalized, 4U);
+    EXPECT_EQ(pack.GetNumRemaining(), count - 4);
+    EXPECT_EQ(notified, 0U);
+    EXPECT_TRUE(pack.ProcessSlice(count, std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(finalized, count);
+    EXPECT_EQ(pack.GetNumRemaining(), 0U);
+    EXPECT_EQ(notified, count);
+}
+
+/**
+ * @tc.name: FinalizersSliceTest002
+ * @tc.desc: Test queued finalizer packs drain in slices, in idle time and at once
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, FinalizersSliceTest002, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t count = 8;
+    static size_t finalized = 0;
+    finalized = 0;
+    NapiNativeFinalize callback = [](napi_env, void*, void*) { finalized++; };
+    auto engine = reinterpret_cast<ArkNativeEngine*>(engine_);
+    auto enqueue = [engine, callback]() {
+        auto pack = std::make_unique<ArkFinalizersPack>();
+        for (size_t i = 0; i < count; i++) {
+            RefFinalizer finalizer(callback, std::make_tuple(engine, nullptr, nullptr));
+            pack->AddFinalizer(finalizer, 0);
+        }
+        engine->finalizersBacklogCount_ += count;
+        engine->finalizersBacklog_.emplace_back(std::move(pack));
+    };
+    const ArkFinalizersStats& stats = engine->GetFinalizersStats();
+    uint64_t slices = stats.slices.load();
+    uint64_t idleSlices = stats.idleSlices.load();
+    uint64_t syncDrains = stats.syncDrains.load();
+
+    enqueue();
+    enqueue();
+    EXPECT_FALSE(engine->RunFinalizersSlice(count + 1, std::numeric_limits<uint64_t>::max(), false));
+    EXPECT_EQ(finalized, count + 1);
+    EXPECT_EQ(engine->finalizersBacklogCount_, count - 1);
+    EXPECT_EQ(stats.backlog.load(), count - 1);
+    EXPECT_EQ(stats.slices.load(), slices + 1);
+
+    engine->RunFinalizersInIdle(100); // 100: ms of idle time, far more than needed
+    EXPECT_EQ(finalized, count * 2);
+    EXPECT_TRUE(engine->finalizersBacklog_.empty());
+    EXPECT_EQ(stats.idleSlices.load(), idleSlices + 1);
+
+    enqueue();
+    engine->DrainFinalizersBacklog();
+    EXPECT_EQ(finalized, count * 3);
+    EXPECT_EQ(engine->finalizersBacklogCount_, 0U);
+    EXPECT_EQ(stats.syncDrains.load(), syncDrains + 1);
+
+    napi_finalizer_stats result;
+    ASSERT_CHECK_CALL(napi_get_finalizer_stats(reinterpret_cast<napi_env>(engine_), &result));
+    EXPECT_EQ(result.backlog, 0U);
+    EXPECT_GE(result.slices, result.idle_slices);
+}
+
 /**
  * @tc.name: ObjectWrapperTest006
  * @tc.desc: Test object wrapper.
@@ -11036,6 +11517,739 @@ HWTEST_F(NapiBasicTest, NapiCreateReferenceTest002, testing::ext::TestSize.Level
     ASSERT_EQ(res, napi_invalid_arg);
 }
 
+/**
+ * @tc.name: ReferenceMemoryStatsTest001
+ * @tc.desc: Test references are carved from the slab of the env and their storage is reused once deleted.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ReferenceMemoryStatsTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t refCount = 1000;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+
+    napi_reference_memory_stats before;
+    ASSERT_CHECK_CALL(napi_get_reference_memory_stats(env, &before));
+    std::vector<napi_ref> refs(refCount, nullptr);
+    for (auto& ref : refs) {
+        ASSERT_CHECK_CALL(napi_create_reference(env, object, 1, &ref));
+    }
+    napi_reference_memory_stats created;
+    ASSERT_CHECK_CALL(napi_get_reference_memory_stats(env, &created));
+    EXPECT_EQ(created.live_references, before.live_references + refCount);
+    EXPECT_GT(created.reserved_bytes, 0);
+
+    for (auto ref : refs) {
+        ASSERT_CHECK_CALL(napi_delete_reference(env, ref));
+    }
+    napi_reference_memory_stats deleted;
+    ASSERT_CHECK_CALL(napi_get_reference_memory_stats(env, &deleted));
+    EXPECT_EQ(deleted.live_references, before.live_references);
+    EXPECT_LE(deleted.reserved_bytes, created.reserved_bytes);
+
+    // new references take the freed storage before any chunk is added
+    for (auto& ref : refs) {
+        ASSERT_CHECK_CALL(napi_create_reference(env, object, 1, &ref));
+    }
+    napi_reference_memory_stats reused;
+    ASSERT_CHECK_CALL(napi_get_reference_memory_stats(env, &reused));
+    EXPECT_LE(reused.reserved_bytes, created.reserved_bytes);
+    for (auto ref : refs) {
+        ASSERT_CHECK_CALL(napi_delete_reference(env, ref));
+    }
+}
+
+/**
+ * @tc.name: ReferenceMemoryStatsTest003
+ * @tc.desc: Test chunks of the reference slab are released once all their references are deleted.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ReferenceMemoryStatsTest003, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t refCount = 10000;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+
+    napi_reference_memory_stats before;
+    ASSERT_CHECK_CALL(napi_get_reference_memory_stats(env, &before));
+    std::vector<napi_ref> refs(refCount, nullptr);
+    for (auto& ref : refs) {
+        ASSERT_CHECK_CALL(napi_create_reference(env, object, 1, &ref));
+    }
+    napi_reference_memory_stats created;
+    ASSERT_CHECK_CALL(napi_get_reference_memory_stats(env, &created));
+
+    for (auto ref : refs) {
+        ASSERT_CHECK_CALL(napi_delete_reference(env, ref));
+    }
+    napi_reference_memory_stats deleted;
+    ASSERT_CHECK_CALL(napi_get_reference_memory_stats(env, &deleted));
+    EXPECT_EQ(deleted.live_references, before.live_references);
+    EXPECT_LT(deleted.reserved_bytes, created.reserved_bytes);
+    EXPECT_LT(deleted.free_reference_slots, refCount);
+}
+
+/**
+ * @tc.name: ReferenceMemoryStatsTest002
+ * @tc.desc: Test interface of napi_get_reference_memory_stats
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ReferenceMemoryStatsTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_reference_memory_stats stats;
+    ASSERT_EQ(napi_get_reference_memory_stats(nullptr, &stats), napi_invalid_arg);
+    ASSERT_EQ(napi_get_reference_memory_stats(env, nullptr), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: NapiCreateReferencesTest001
+ * @tc.desc: Test interface of napi_create_references and napi_delete_references
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NapiCreateReferencesTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t count = 100;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    std::vector<napi_value> values(count, nullptr);
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_CHECK_CALL(napi_create_uint32(env, static_cast<uint32_t>(i), &values[i]));
+    }
+    std::vector<napi_ref> refs(count, nullptr);
+    EXPECT_EQ(napi_create_references(nullptr, count, values.data(), 1, refs.data()), napi_invalid_arg);
+    EXPECT_EQ(napi_create_references(env, count, nullptr, 1, refs.data()), napi_invalid_arg);
+    EXPECT_EQ(napi_create_references(env, count, values.data(), 1, nullptr), napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_create_references(env, 0, nullptr, 1, nullptr));
+
+    napi_reference_memory_stats before;
+    ASSERT_CHECK_CALL(napi_get_reference_memory_stats(env, &before));
+    std::vector<napi_value> withNull(values);
+    withNull[count - 1] = nullptr;
+    EXPECT_EQ(napi_create_references(env, count, withNull.data(), 1, refs.data()), napi_invalid_arg);
+    napi_reference_memory_stats stats;
+    ASSERT_CHECK_CALL(napi_get_reference_memory_stats(env, &stats));
+    EXPECT_EQ(stats.live_references, before.live_references);
+
+    ASSERT_CHECK_CALL(napi_create_references(env, count, values.data(), 1, refs.data()));
+    ASSERT_CHECK_CALL(napi_get_reference_memory_stats(env, &stats));
+    EXPECT_EQ(stats.live_references, before.live_references + count);
+    for (size_t i = 0; i < count; i++) {
+        napi_value result = nullptr;
+        uint32_t number = 0;
+        ASSERT_CHECK_CALL(napi_get_reference_value(env, refs[i], &result));
+        ASSERT_CHECK_CALL(napi_get_value_uint32(env, result, &number));
+        EXPECT_EQ(number, i);
+    }
+
+    EXPECT_EQ(napi_delete_references(env, count, nullptr), napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_delete_references(env, count, refs.data()));
+    ASSERT_CHECK_CALL(napi_get_reference_memory_stats(env, &stats));
+    EXPECT_EQ(stats.live_references, before.live_references);
+}
+
+/**
+ * @tc.name: GetCbArgsTest001
+ * @tc.desc: Test interface of napi_get_cb_args with required, optional and mistyped arguments
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, GetCbArgsTest001, testing::ext::TestSize.Level1)
+{
+    struct Args {
+        int32_t x;
+        int32_t y;
+        double scale;
+        char name[8];
+        size_t nameLength;
+        bool visible;
+    };
+    static Args args;
+    static napi_status status;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value fn = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, nullptr, 0, [](napi_env env, napi_callback_info info) -> napi_value {
+        status = napi_get_cb_args(env, info, "iid s|b", &args.x, &args.y, &args.scale, args.name, sizeof(args.name),
+                                  &args.nameLength, &args.visible);
+        return nullptr;
+    }, nullptr, &fn));
+
+    napi_value argv[5] = { nullptr };
+    ASSERT_CHECK_CALL(napi_create_int32(env, 1, &argv[0]));
+    ASSERT_CHECK_CALL(napi_create_int32(env, -2, &argv[1]));
+    ASSERT_CHECK_CALL(napi_create_double(env, 1.5, &argv[2]));
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, "rect", NAPI_AUTO_LENGTH, &argv[3]));
+    ASSERT_CHECK_CALL(napi_get_boolean(env, false, &argv[4]));
+    napi_value global = nullptr;
+    ASSERT_CHECK_CALL(napi_get_global(env, &global));
+
+    args.visible = true;
+    ASSERT_CHECK_CALL(napi_call_function(env, global, fn, 4, argv, nullptr));
+    ASSERT_EQ(status, napi_ok);
+    EXPECT_EQ(args.x, 1);
+    EXPECT_EQ(args.y, -2);
+    EXPECT_EQ(args.scale, 1.5);
+    EXPECT_STREQ(args.name, "rect");
+    EXPECT_EQ(args.nameLength, strlen("rect"));
+    EXPECT_TRUE(args.visible);
+
+    ASSERT_CHECK_CALL(napi_call_function(env, global, fn, 5, argv, nullptr));
+    ASSERT_EQ(status, napi_ok);
+    EXPECT_FALSE(args.visible);
+
+    ASSERT_CHECK_CALL(napi_call_function(env, global, fn, 3, argv, nullptr));
+    EXPECT_EQ(status, napi_invalid_arg);
+
+    // the copy is truncated, the length is not
+    std::string longName(sizeof(args.name) * 2, 'a');
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, longName.c_str(), longName.size(), &argv[3]));
+    ASSERT_CHECK_CALL(napi_call_function(env, global, fn, 4, argv, nullptr));
+    ASSERT_EQ(status, napi_ok);
+    EXPECT_EQ(strlen(args.name), sizeof(args.name) - 1);
+    EXPECT_EQ(args.nameLength, longName.size());
+
+    argv[1] = argv[3];
+    ASSERT_CHECK_CALL(napi_call_function(env, global, fn, 4, argv, nullptr));
+    EXPECT_EQ(status, napi_number_expected);
+}
+
+static int32_t BindingScale(int32_t value, double factor)
+{
+    return static_cast<int32_t>(value * factor);
+}
+
+static std::string BindingGreet(std::string_view name, bool excited)
+{
+    return "hello " + std::string(name) + (excited ? "!" : "");
+}
+
+/**
+ * @tc.name: NativeBindingTest001
+ * @tc.desc: Test callbacks generated by NapiBinding convert arguments and results and throw on wrong types
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NativeBindingTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value exports = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &exports));
+    ASSERT_CHECK_CALL(NapiBinding::DefineFunctions(env, exports, {
+        NapiBinding::Function<BindingScale>("scale"),
+        NapiBinding::Function<BindingGreet>("greet"),
+    }));
+    napi_value scale = nullptr;
+    napi_value greet = nullptr;
+    ASSERT_CHECK_CALL(napi_get_named_property(env, exports, "scale", &scale));
+    ASSERT_CHECK_CALL(napi_get_named_property(env, exports, "greet", &greet));
+
+    napi_value argv[2] = { nullptr };
+    ASSERT_CHECK_CALL(napi_create_int32(env, 21, &argv[0]));
+    ASSERT_CHECK_CALL(napi_create_double(env, 2.0, &argv[1]));
+    napi_value result = nullptr;
+    ASSERT_CHECK_CALL(napi_call_function(env, exports, scale, 2, argv, &result));
+    int32_t scaled = 0;
+    ASSERT_CHECK_CALL(napi_get_value_int32(env, result, &scaled));
+    EXPECT_EQ(scaled, 42);
+
+    std::string longName(NapiBinding::StringArg::INLINE_SIZE * 2, 'a');
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, longName.c_str(), longName.size(), &argv[0]));
+    ASSERT_CHECK_CALL(napi_get_boolean(env, true, &argv[1]));
+    ASSERT_CHECK_CALL(napi_call_function(env, exports, greet, 2, argv, &result));
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_get_value_string_utf8(env, result, nullptr, 0, &length));
+    EXPECT_EQ(length, longName.size() + strlen("hello !"));
+
+    bool isPending = false;
+    napi_call_function(env, exports, scale, 2, argv, &result);
+    ASSERT_CHECK_CALL(napi_is_exception_pending(env, &isPending));
+    EXPECT_TRUE(isPending);
+    napi_value exception = nullptr;
+    ASSERT_CHECK_CALL(napi_get_and_clear_last_exception(env, &exception));
+}
+
+/**
+ * @tc.name: NamedAccessorTest001
+ * @tc.desc: Test interface of napi_get_named_property_cached and napi_set_named_property_cached
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NamedAccessorTest001, testing::ext::TestSize.Level1)
+{
+    static napi_named_accessor widthAccessor = NAPI_NAMED_ACCESSOR("width");
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    auto engine = reinterpret_cast<ArkNativeEngine*>(engine_);
+    size_t cached = engine->GetNamedAccessorCache().Size();
+    napi_value value = nullptr;
+    ASSERT_CHECK_CALL(napi_create_int32(env, 100, &value));
+
+    for (int32_t i = 0; i < 3; i++) {
+        napi_value object = nullptr;
+        ASSERT_CHECK_CALL(napi_create_object(env, &object));
+        ASSERT_CHECK_CALL(napi_set_named_property_cached(env, object, &widthAccessor, value));
+        napi_value result = nullptr;
+        ASSERT_CHECK_CALL(napi_get_named_property(env, object, "width", &result));
+        int32_t width = 0;
+        ASSERT_CHECK_CALL(napi_get_value_int32(env, result, &width));
+        EXPECT_EQ(width, 100);
+        ASSERT_CHECK_CALL(napi_get_named_property_cached(env, object, &widthAccessor, &result));
+        ASSERT_CHECK_CALL(napi_get_value_int32(env, result, &width));
+        EXPECT_EQ(width, 100);
+    }
+    EXPECT_NE(widthAccessor.id, 0u);
+    EXPECT_LE(engine->GetNamedAccessorCache().Size(), cached + 1);
+
+    napi_named_accessor unnamed = NAPI_NAMED_ACCESSOR(nullptr);
+    napi_value result = nullptr;
+    EXPECT_EQ(napi_get_named_property_cached(env, value, &unnamed, &result), napi_invalid_arg);
+    EXPECT_EQ(napi_get_named_property_cached(env, value, nullptr, &result), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: NamedPropertiesTest001
+ * @tc.desc: Test interface of napi_get_named_properties and napi_set_named_properties
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NamedPropertiesTest001, testing::ext::TestSize.Level1)
+{
+    static napi_named_accessor accessors[] = {
+        NAPI_NAMED_ACCESSOR("id"),
+        NAPI_NAMED_ACCESSOR("name"),
+        NAPI_NAMED_ACCESSOR("score"),
+    };
+    static constexpr size_t count = sizeof(accessors) / sizeof(accessors[0]);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value values[count] = { nullptr };
+    ASSERT_CHECK_CALL(napi_create_int32(env, 7, &values[0]));
+    ASSERT_CHECK_CALL(napi_create_string_utf8(env, "record", NAPI_AUTO_LENGTH, &values[1]));
+    ASSERT_CHECK_CALL(napi_create_double(env, 0.5, &values[2]));
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    ASSERT_CHECK_CALL(napi_set_named_properties(env, object, count, accessors, values));
+
+    napi_value name = nullptr;
+    ASSERT_CHECK_CALL(napi_get_named_property(env, object, "name", &name));
+    bool isEqual = false;
+    ASSERT_CHECK_CALL(napi_strict_equals(env, name, values[1], &isEqual));
+    EXPECT_TRUE(isEqual);
+
+    napi_value results[count] = { nullptr };
+    ASSERT_CHECK_CALL(napi_get_named_properties(env, object, count, accessors, results));
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_CHECK_CALL(napi_strict_equals(env, results[i], values[i], &isEqual));
+        EXPECT_TRUE(isEqual);
+    }
+
+    napi_value empty = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &empty));
+    ASSERT_CHECK_CALL(napi_get_named_properties(env, empty, count, accessors, results));
+    napi_valuetype type = napi_null;
+    ASSERT_CHECK_CALL(napi_typeof(env, results[0], &type));
+    EXPECT_EQ(type, napi_undefined);
+
+    EXPECT_EQ(napi_get_named_properties(env, object, count, nullptr, results), napi_invalid_arg);
+    values[2] = nullptr;
+    EXPECT_EQ(napi_set_named_properties(env, object, count, accessors, values), napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_get_named_properties(env, object, 0, nullptr, nullptr));
+}
+
+/**
+ * @tc.name: FunctionInfoPoolTest001
+ * @tc.desc: Test function infos are reused from the pool and outlive the release of the pool
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, FunctionInfoPoolTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t count = ArkFunctionInfoPool::CHUNK_SLOTS + 1;
+    auto pool = new ArkFunctionInfoPool();
+    std::vector<NapiFunctionInfo*> infos;
+    for (size_t i = 0; i < count; i++) {
+        NapiFunctionInfo* info = pool->Allocate();
+        ASSERT_NE(info, nullptr);
+        EXPECT_EQ(info->callback, nullptr);
+        info->data = info;
+        infos.push_back(info);
+    }
+    EXPECT_EQ(pool->GetLiveCount(), count);
+
+    NapiFunctionInfo* freed = infos.back();
+    ArkFunctionInfoPool::Deleter(nullptr, nullptr, freed);
+    EXPECT_EQ(pool->GetLiveCount(), count - 1);
+    NapiFunctionInfo* reused = pool->Allocate();
+    EXPECT_EQ(reused, freed);
+    EXPECT_EQ(reused->data, nullptr);
+
+    // the pool goes away with its last info
+    pool->Release();
+    for (NapiFunctionInfo* info : infos) {
+        ArkFunctionInfoPool::Deleter(nullptr, nullptr, info);
+    }
+
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    auto engine = reinterpret_cast<ArkNativeEngine*>(engine_);
+    size_t live = engine->GetFunctionInfoPool()->GetLiveCount();
+    napi_value fn = nullptr;
+    ASSERT_CHECK_CALL(napi_create_function(env, nullptr, 0, [](napi_env, napi_callback_info) -> napi_value {
+        return nullptr;
+    }, nullptr, &fn));
+    EXPECT_EQ(engine->GetFunctionInfoPool()->GetLiveCount(), live + 1);
+}
+
+/**
+ * @tc.name: FunctionInfoPoolTest002
+ * @tc.desc: Test chunks of the pool are freed once all their infos are back
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, FunctionInfoPoolTest002, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t count = ArkFunctionInfoPool::CHUNK_SLOTS * 2;
+    auto pool = new ArkFunctionInfoPool();
+    std::vector<NapiFunctionInfo*> infos;
+    for (size_t i = 0; i < count; i++) {
+        NapiFunctionInfo* info = pool->Allocate();
+        ASSERT_NE(info, nullptr);
+        infos.push_back(info);
+    }
+    EXPECT_EQ(pool->GetChunkCount(), 2);
+
+    // the first chunk empties and goes away, the current one is kept for the next allocation
+    for (size_t i = 0; i < ArkFunctionInfoPool::CHUNK_SLOTS; i++) {
+        ArkFunctionInfoPool::Deleter(nullptr, nullptr, infos[i]);
+    }
+    EXPECT_EQ(pool->GetChunkCount(), 1);
+    for (size_t i = ArkFunctionInfoPool::CHUNK_SLOTS; i < count; i++) {
+        ArkFunctionInfoPool::Deleter(nullptr, nullptr, infos[i]);
+    }
+    EXPECT_EQ(pool->GetChunkCount(), 1);
+    EXPECT_EQ(pool->GetLiveCount(), 0);
+    NapiFunctionInfo* info = pool->Allocate();
+    ASSERT_NE(info, nullptr);
+    EXPECT_EQ(pool->GetChunkCount(), 1);
+    pool->Release();
+    ArkFunctionInfoPool::Deleter(nullptr, nullptr, info);
+}
+
+/**
+ * @tc.name: WeakTableTest001
+ * @tc.desc: Test interface of napi_create_weak_table and its set, get, delete and size
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, WeakTableTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_weak_table table = nullptr;
+    EXPECT_EQ(napi_create_weak_table(nullptr, nullptr, nullptr, &table), napi_invalid_arg);
+    EXPECT_EQ(napi_create_weak_table(env, nullptr, nullptr, nullptr), napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_create_weak_table(env, nullptr, nullptr, &table));
+    ASSERT_NE(table, nullptr);
+
+    int keys[2] = {0};
+    napi_value first = nullptr;
+    napi_value second = nullptr;
+    napi_value result = nullptr;
+    size_t size = 0;
+    ASSERT_CHECK_CALL(napi_create_object(env, &first));
+    ASSERT_CHECK_CALL(napi_create_object(env, &second));
+    EXPECT_EQ(napi_weak_table_set(env, nullptr, &keys[0], first), napi_invalid_arg);
+    EXPECT_EQ(napi_weak_table_set(env, table, &keys[0], nullptr), napi_invalid_arg);
+    EXPECT_EQ(napi_weak_table_get(env, table, &keys[0], nullptr), napi_invalid_arg);
+    EXPECT_EQ(napi_weak_table_size(env, table, nullptr), napi_invalid_arg);
+
+    ASSERT_CHECK_CALL(napi_weak_table_set(env, table, &keys[0], first));
+    ASSERT_CHECK_CALL(napi_weak_table_set(env, table, &keys[1], first));
+    ASSERT_CHECK_CALL(napi_weak_table_set(env, table, &keys[1], second));
+    ASSERT_CHECK_CALL(napi_weak_table_size(env, table, &size));
+    EXPECT_EQ(size, 2U);
+    bool equal = false;
+    ASSERT_CHECK_CALL(napi_weak_table_get(env, table, &keys[1], &result));
+    ASSERT_CHECK_CALL(napi_strict_equals(env, result, second, &equal));
+    EXPECT_TRUE(equal);
+
+    ASSERT_CHECK_CALL(napi_weak_table_delete(env, table, &keys[1]));
+    ASSERT_CHECK_CALL(napi_weak_table_delete(env, table, &keys[1]));
+    ASSERT_CHECK_CALL(napi_weak_table_get(env, table, &keys[1], &result));
+    EXPECT_EQ(result, nullptr);
+    ASSERT_CHECK_CALL(napi_weak_table_size(env, table, &size));
+    EXPECT_EQ(size, 1U);
+
+    EXPECT_EQ(napi_delete_weak_table(env, nullptr), napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_delete_weak_table(env, table));
+}
+
+/**
+ * @tc.name: WeakTableTest002
+ * @tc.desc: Test keys of collected entries reach the weak table callback in one batch
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, WeakTableTest002, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t count = 4;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    auto engine = reinterpret_cast<ArkNativeEngine*>(engine_);
+    std::vector<void*> collected;
+    size_t calls = 0;
+    auto callback = [](napi_env, napi_weak_table, void* const* keys, size_t num, void* data) {
+        auto record = reinterpret_cast<std::pair<std::vector<void*>*, size_t*>*>(data);
+        record->first->insert(record->first->end(), keys, keys + num);
+        (*record->second)++;
+    };
+    std::pair<std::vector<void*>*, size_t*> record(&collected, &calls);
+    napi_weak_table table = nullptr;
+    ASSERT_CHECK_CALL(napi_create_weak_table(env, callback, &record, &table));
+    int keys[count] = {0};
+    for (size_t i = 0; i < count; i++) {
+        napi_value object = nullptr;
+        ASSERT_CHECK_CALL(napi_create_object(env, &object));
+        ASSERT_CHECK_CALL(napi_weak_table_set(env, table, &keys[i], object));
+    }
+
+    // what the GC does to entries whose values died
+    auto weakTable = reinterpret_cast<ArkNativeWeakTable*>(table);
+    ArkFinalizersPack& pack = engine->GetArkFinalizersPack();
+    size_t queued = pack.GetNumFinalizers();
+    ArkNativeReference::NativeFinalizeCallBack(weakTable->entries_[&keys[0]]);
+    ArkNativeReference::NativeFinalizeCallBack(weakTable->entries_[&keys[1]]);
+    EXPECT_EQ(weakTable->Size(), count - 2);
+    EXPECT_EQ(pack.GetNumFinalizers(), queued + 1);
+    pack.ProcessAll();
+    EXPECT_EQ(calls, 1U);
+    ASSERT_EQ(collected.size(), 2U);
+    EXPECT_EQ(collected[0], &keys[0]);
+    EXPECT_EQ(collected[1], &keys[1]);
+
+    // a table deleted before its notification does not call back
+    ArkNativeReference::NativeFinalizeCallBack(weakTable->entries_[&keys[2]]);
+    ASSERT_CHECK_CALL(napi_delete_weak_table(env, table));
+    pack.ProcessAll();
+    EXPECT_EQ(calls, 1U);
+    pack.Clear();
+}
+
+/**
+ * @tc.name: StrongHandleTest001
+ * @tc.desc: Test interface of napi_create_strong_handle and its get, set and delete
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, StrongHandleTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr uint32_t count = 2000;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_strong_handle handle = 0;
+    napi_value value = nullptr;
+    ASSERT_CHECK_CALL(napi_create_uint32(env, 0, &value));
+    EXPECT_EQ(napi_create_strong_handle(nullptr, value, &handle), napi_invalid_arg);
+    EXPECT_EQ(napi_create_strong_handle(env, nullptr, &handle), napi_invalid_arg);
+    EXPECT_EQ(napi_create_strong_handle(env, value, nullptr), napi_invalid_arg);
+    EXPECT_EQ(napi_get_strong_handle_value(env, 0, &value), napi_invalid_arg);
+
+    std::vector<napi_strong_handle> handles(count, 0);
+    {
+        panda::LocalScope scope(engine_->GetEcmaVm());
+        for (uint32_t i = 0; i < count; i++) {
+            napi_value object = nullptr;
+            napi_value number = nullptr;
+            ASSERT_CHECK_CALL(napi_create_object(env, &object));
+            ASSERT_CHECK_CALL(napi_create_uint32(env, i, &number));
+            ASSERT_CHECK_CALL(napi_set_named_property(env, object, "id", number));
+            ASSERT_CHECK_CALL(napi_create_strong_handle(env, object, &handles[i]));
+            EXPECT_NE(handles[i], 0U);
+        }
+    }
+    panda::JSNApi::TriggerGC(engine_->GetEcmaVm(), panda::ecmascript::GCReason::OTHER,
+                             panda::JSNApi::TRIGGER_GC_TYPE::FULL_GC);
+    for (uint32_t i = 0; i < count; i++) {
+        napi_value object = nullptr;
+        napi_value number = nullptr;
+        uint32_t id = 0;
+        ASSERT_CHECK_CALL(napi_get_strong_handle_value(env, handles[i], &object));
+        ASSERT_CHECK_CALL(napi_get_named_property(env, object, "id", &number));
+        ASSERT_CHECK_CALL(napi_get_value_uint32(env, number, &id));
+        EXPECT_EQ(id, i);
+    }
+
+    uint32_t number = 0;
+    ASSERT_CHECK_CALL(napi_set_strong_handle_value(env, handles[0], value));
+    ASSERT_CHECK_CALL(napi_get_strong_handle_value(env, handles[0], &value));
+    ASSERT_CHECK_CALL(napi_get_value_uint32(env, value, &number));
+    EXPECT_EQ(number, 0U);
+
+    ASSERT_CHECK_CALL(napi_delete_strong_handle(env, handles[1]));
+    EXPECT_EQ(napi_delete_strong_handle(env, handles[1]), napi_invalid_arg);
+    EXPECT_EQ(napi_get_strong_handle_value(env, handles[1], &value), napi_invalid_arg);
+    EXPECT_EQ(napi_set_strong_handle_value(env, handles[1], value), napi_invalid_arg);
+    // the slot is reused under a new generation, the deleted handle stays invalid
+    ASSERT_CHECK_CALL(napi_create_strong_handle(env, value, &handle));
+    EXPECT_NE(handle, handles[1]);
+    EXPECT_EQ(napi_get_strong_handle_value(env, handles[1], &value), napi_invalid_arg);
+    handles[1] = handle;
+    for (uint32_t i = 0; i < count; i++) {
+        ASSERT_CHECK_CALL(napi_delete_strong_handle(env, handles[i]));
+    }
+    EXPECT_EQ(reinterpret_cast<ArkNativeEngine*>(engine_)->GetHandleTable().Size(), 0U);
+}
+
+/**
+ * @tc.name: ReferenceRegistryTest001
+ * @tc.desc: Test runtime owned references are grouped by finalize callback and leave the registry on delete.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, ReferenceRegistryTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t wrapCount = 100;
+    static constexpr size_t otherCount = 10;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    NativeReferenceManager* manager = engine_->GetReferenceManager();
+    ASSERT_NE(manager, nullptr);
+    size_t baseCount = manager->GetReferenceCount();
+
+    napi_finalize wrapFinalizer = [](napi_env, void*, void*) {};
+    napi_finalize otherFinalizer = [](napi_env, void*, void*) {};
+    std::vector<napi_value> objects(wrapCount + otherCount, nullptr);
+    for (size_t i = 0; i < objects.size(); i++) {
+        ASSERT_CHECK_CALL(napi_create_object(env, &objects[i]));
+        ASSERT_CHECK_CALL(napi_wrap(env, objects[i], reinterpret_cast<void*>(i + 1),
+            i < wrapCount ? wrapFinalizer : otherFinalizer, nullptr, nullptr));
+    }
+    EXPECT_EQ(manager->GetReferenceCount(), baseCount + objects.size());
+
+    std::vector<NativeReferenceFinalizerStats> stats;
+    manager->GetFinalizerStats(stats);
+    auto findGroup = [&stats](napi_finalize finalizer) -> const NativeReferenceFinalizerStats* {
+        for (const auto& group : stats) {
+            if (group.finalizer == reinterpret_cast<uintptr_t>(finalizer)) {
+                return &group;
+            }
+        }
+        return nullptr;
+    };
+    ASSERT_NE(findGroup(wrapFinalizer), nullptr);
+    ASSERT_NE(findGroup(otherFinalizer), nullptr);
+    EXPECT_EQ(findGroup(wrapFinalizer)->count, wrapCount);
+    EXPECT_EQ(findGroup(otherFinalizer)->count, otherCount);
+    EXPECT_EQ(napi_dump_references_by_finalizer(env, stats.size(), nullptr, 0, nullptr), napi_invalid_arg);
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_dump_references_by_finalizer(env, stats.size(), nullptr, 0, &length));
+    std::string dump(length + 1, '\0');
+    size_t copied = 0;
+    ASSERT_CHECK_CALL(napi_dump_references_by_finalizer(env, stats.size(), dump.data(), dump.size(), &copied));
+    EXPECT_EQ(copied, length);
+    EXPECT_NE(dump.find("count 100,"), std::string::npos);
+
+    for (auto object : objects) {
+        void* data = nullptr;
+        ASSERT_CHECK_CALL(napi_remove_wrap(env, object, &data));
+    }
+    EXPECT_EQ(manager->GetReferenceCount(), baseCount);
+}
+
+/**
+ * @tc.name: NativeMemoryAccountingTest001
+ * @tc.desc: Test native binding sizes are accounted per finalize callback until the wrap goes away.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NativeMemoryAccountingTest001, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t objectCount = 3;
+    static constexpr size_t bindingSize = 1000;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_native_memory_info base;
+    ASSERT_CHECK_CALL(napi_get_native_memory_info(env, &base));
+
+    napi_finalize finalizer = [](napi_env, void*, void*) {};
+    std::vector<napi_value> objects(objectCount, nullptr);
+    for (size_t i = 0; i < objects.size(); i++) {
+        ASSERT_CHECK_CALL(napi_create_object(env, &objects[i]));
+        ASSERT_CHECK_CALL(napi_wrap_with_size(env, objects[i], reinterpret_cast<void*>(i + 1), finalizer, nullptr,
+            nullptr, bindingSize));
+    }
+    napi_native_memory_info info;
+    ASSERT_CHECK_CALL(napi_get_native_memory_info(env, &info));
+    EXPECT_EQ(info.binding_objects, base.binding_objects + objectCount);
+    EXPECT_EQ(info.binding_bytes, base.binding_bytes + objectCount * bindingSize);
+    EXPECT_GE(info.peak_bytes, info.binding_bytes);
+
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_dump_native_memory(env, SIZE_MAX, nullptr, 0, &length));
+    std::string dump(length + 1, '\0');
+    size_t copied = 0;
+    ASSERT_CHECK_CALL(napi_dump_native_memory(env, SIZE_MAX, dump.data(), dump.size(), &copied));
+    EXPECT_EQ(copied, length);
+    std::ostringstream expected;
+    expected << "tag 0x" << std::hex << reinterpret_cast<uintptr_t>(finalizer) << std::dec << ": "
+             << objectCount * bindingSize << " bytes in " << objectCount << " objects";
+    EXPECT_NE(dump.find(expected.str()), std::string::npos);
+
+    for (auto object : objects) {
+        void* data = nullptr;
+        ASSERT_CHECK_CALL(napi_remove_wrap(env, object, &data));
+    }
+    ASSERT_CHECK_CALL(napi_get_native_memory_info(env, &info));
+    EXPECT_EQ(info.binding_objects, base.binding_objects);
+    EXPECT_EQ(info.binding_bytes, base.binding_bytes);
+}
+
+/**
+ * @tc.name: NativeMemoryAccountingTest002
+ * @tc.desc: Test napi_adjust_external_memory keeps a running total that never drops below zero.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NativeMemoryAccountingTest002, testing::ext::TestSize.Level1)
+{
+    static constexpr int64_t change = 4096;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_native_memory_info info;
+    EXPECT_EQ(napi_get_native_memory_info(nullptr, &info), napi_invalid_arg);
+    EXPECT_EQ(napi_get_native_memory_info(env, nullptr), napi_invalid_arg);
+    EXPECT_EQ(napi_dump_native_memory(env, 1, nullptr, 0, nullptr), napi_invalid_arg);
+    ASSERT_CHECK_CALL(napi_get_native_memory_info(env, &info));
+
+    int64_t adjusted = 0;
+    ASSERT_CHECK_CALL(napi_adjust_external_memory(env, change, &adjusted));
+    EXPECT_EQ(adjusted, info.external_bytes + change);
+    ASSERT_CHECK_CALL(napi_adjust_external_memory(env, -change, &adjusted));
+    EXPECT_EQ(adjusted, info.external_bytes);
+    ASSERT_CHECK_CALL(napi_adjust_external_memory(env, INT64_MIN / 2, &adjusted));
+    EXPECT_EQ(adjusted, 0);
+
+    char buf[8] = { 0 };
+    size_t copied = 0;
+    ASSERT_CHECK_CALL(napi_dump_native_memory(env, 1, buf, sizeof(buf), &copied));
+    EXPECT_EQ(copied, sizeof(buf) - 1);
+    EXPECT_EQ(strlen(buf), copied);
+}
+
+/**
+ * @tc.name: NativeMemoryAccountingTest003
+ * @tc.desc: Test binding bytes leave the tag they were added under after the finalizer is reset.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NativeMemoryAccountingTest003, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t bindingSize = 1000;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_native_memory_info base;
+    ASSERT_CHECK_CALL(napi_get_native_memory_info(env, &base));
+
+    NapiNativeFinalize finalizer = [](napi_env, void*, void*) {};
+    napi_value object = nullptr;
+    ASSERT_CHECK_CALL(napi_create_object(env, &object));
+    NativeReference* ref = engine_->CreateReference(object, 1, false, finalizer, nullptr, nullptr, bindingSize);
+    ASSERT_NE(ref, nullptr);
+    ref->ResetFinalizer();
+    delete ref;
+
+    napi_native_memory_info info;
+    ASSERT_CHECK_CALL(napi_get_native_memory_info(env, &info));
+    EXPECT_EQ(info.binding_objects, base.binding_objects);
+    EXPECT_EQ(info.binding_bytes, base.binding_bytes);
+    size_t length = 0;
+    ASSERT_CHECK_CALL(napi_dump_native_memory(env, SIZE_MAX, nullptr, 0, &length));
+    std::string dump(length + 1, '\0');
+    size_t copied = 0;
+    ASSERT_CHECK_CALL(napi_dump_native_memory(env, SIZE_MAX, dump.data(), dump.size(), &copied));
+    std::ostringstream tag;
+    tag << "tag 0x" << std::hex << reinterpret_cast<uintptr_t>(finalizer) << ":";
+    EXPECT_EQ(dump.find(tag.str()), std::string::npos);
+}
+
 /**
  * @tc.name: NapiCreateReferenceTest
  * @tc.desc: Test interface of napi_create_reference
@@ -13823,6 +15037,67 @@ HWTEST_F(NapiBasicTest, NapiQueueAsyncWorkWithQosTest003, testing::ext::TestSize
     RUN_EVENT_LOOP(env);
 }
 
+/**
+ * @tc.name: NapiQueueAsyncWorkWithQosTest
+ * @tc.desc: Test napi_queue_async_work_with_qos on the work stealing pool
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NapiQueueAsyncWorkWithQosTest004, testing::ext::TestSize.Level1)
+{
+    ASSERT_NE(engine_, nullptr);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+
+    struct PoolWorkContext {
+        napi_async_work work = nullptr;
+        std::thread::id jsThread;
+        std::thread::id executeThread;
+        int* completed = nullptr;
+    };
+    int completed = 0;
+    napi_value resourceName = nullptr;
+    napi_create_string_utf8(env, TEST_CHAR_STRING, NAPI_AUTO_LENGTH, &resourceName);
+    ASSERT_CHECK_CALL(napi_start_async_work_pool(env, INT_TWO));
+    for (int i = 0; i < ASYNC_WORK_NUM; ++i) {
+        auto context = new PoolWorkContext();
+        context->jsThread = std::this_thread::get_id();
+        context->completed = &completed;
+        ASSERT_CHECK_CALL(napi_create_async_work(
+            env, nullptr, resourceName,
+            [](napi_env env, void* data) {
+                auto context = reinterpret_cast<PoolWorkContext*>(data);
+                context->executeThread = std::this_thread::get_id();
+            },
+            [](napi_env env, napi_status status, void* data) {
+                auto context = reinterpret_cast<PoolWorkContext*>(data);
+                EXPECT_EQ(status, napi_ok);
+                EXPECT_EQ(std::this_thread::get_id(), context->jsThread);
+                EXPECT_NE(context->executeThread, context->jsThread);
+                if (++(*context->completed) == ASYNC_WORK_NUM) {
+                    STOP_EVENT_LOOP(env);
+                }
+                napi_delete_async_work(env, context->work);
+                delete context;
+            },
+            context, &context->work));
+        ASSERT_EQ(napi_queue_async_work_with_qos(env, context->work, napi_qos_t(i % (napi_qos_user_initiated + 1))),
+                  napi_ok);
+    }
+    RUN_EVENT_LOOP(env);
+    EXPECT_EQ(completed, ASYNC_WORK_NUM);
+    ASSERT_CHECK_CALL(napi_stop_async_work_pool(env));
+}
+
+/**
+ * @tc.name: NapiQueueAsyncWorkWithQosTest
+ * @tc.desc: Test interface of napi_start_async_work_pool and napi_stop_async_work_pool
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NapiQueueAsyncWorkWithQosTest005, testing::ext::TestSize.Level1)
+{
+    ASSERT_EQ(napi_start_async_work_pool(nullptr, 0), napi_invalid_arg);
+    ASSERT_EQ(napi_stop_async_work_pool(nullptr), napi_invalid_arg);
+}
+
 /**
  * @tc.name: NapiRunScriptPathTest
  * @tc.desc: Test interface of napi_run_script_path
@@ -15183,6 +16458,175 @@ HWTEST_F(NapiBasicTest, NapiQueueAsyncWorkWithQueueTest009, testing::ext::TestSi
     ASSERT_EQ(res, napi_ok);
 }
 
+/**
+ * @tc.name: NapiQueueAsyncWorkWithQueueTest010
+ * @tc.desc: Test works of two ordered queues run and complete FIFO per queue
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NapiQueueAsyncWorkWithQueueTest010, testing::ext::TestSize.Level1)
+{
+    static constexpr int queueCount = 2;
+    struct OrderedContext {
+        napi_async_work work = nullptr;
+        int workid = 0;
+        std::atomic<int>* executed = nullptr;
+        int* completed = nullptr;
+    };
+    UVLoopRunner runner(engine_);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_async_work_queue_stats before;
+    ASSERT_CHECK_CALL(napi_get_async_work_queue_stats(env, &before));
+
+    std::atomic<int> executed[queueCount] = {0, 0};
+    int completed[queueCount] = {0, 0};
+    uintptr_t queueIds[queueCount] = {reinterpret_cast<uintptr_t>(&executed[0]),
+                                      reinterpret_cast<uintptr_t>(&executed[1])};
+    std::unique_ptr<OrderedContext> contexts[queueCount][ASYNC_WORK_NUM];
+    napi_value resourceName = nullptr;
+    napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName);
+    for (int i = 0; i < ASYNC_WORK_NUM; ++i) {
+        for (int q = 0; q < queueCount; ++q) {
+            auto& context = contexts[q][i];
+            context = std::make_unique<OrderedContext>();
+            context->workid = i;
+            context->executed = &executed[q];
+            context->completed = &completed[q];
+            ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+                [](napi_env env, void* data) {
+                    auto context = reinterpret_cast<OrderedContext*>(data);
+                    EXPECT_EQ(context->executed->load(), context->workid);
+                    context->executed->fetch_add(1);
+                },
+                [](napi_env env, napi_status status, void* data) {
+                    auto context = reinterpret_cast<OrderedContext*>(data);
+                    EXPECT_EQ(status, napi_ok);
+                    EXPECT_EQ(*context->completed, context->workid);
+                    (*context->completed)++;
+                    napi_delete_async_work(env, context->work);
+                },
+                context.get(), &context->work));
+            ASSERT_CHECK_CALL(napi_queue_async_work_with_queue(env, context->work, napi_qos_default, queueIds[q]));
+        }
+    }
+    runner.Run();
+
+    for (int q = 0; q < queueCount; ++q) {
+        EXPECT_EQ(completed[q], ASYNC_WORK_NUM);
+    }
+    napi_async_work_queue_stats after;
+    ASSERT_CHECK_CALL(napi_get_async_work_queue_stats(env, &after));
+    // works other cases left in their queues drain in the same run
+    EXPECT_GE(after.executed - before.executed, static_cast<uint64_t>(queueCount * ASYNC_WORK_NUM));
+    EXPECT_EQ(after.active_queues, 0U);
+    EXPECT_EQ(after.pending, 0U);
+}
+
+/**
+ * @tc.name: NapiQueueAsyncWorkWithQueueTest011
+ * @tc.desc: Test an ordered queue refuses works beyond its backlog
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NapiQueueAsyncWorkWithQueueTest011, testing::ext::TestSize.Level1)
+{
+    // the first work starts draining at once, the following ones fill the backlog
+    static constexpr size_t acceptedCount = NativeSerialExecutorRegistry::MAX_BACKLOG + 1;
+    UVLoopRunner runner(engine_);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value resourceName = nullptr;
+    napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName);
+    uintptr_t queueId = reinterpret_cast<uintptr_t>(&resourceName);
+    napi_async_work_queue_stats before;
+    ASSERT_CHECK_CALL(napi_get_async_work_queue_stats(env, &before));
+
+    std::vector<napi_async_work> works(acceptedCount + 1, nullptr);
+    for (size_t i = 0; i < works.size(); ++i) {
+        ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+            [](napi_env env, void* data) {},
+            [](napi_env env, napi_status status, void* data) {},
+            nullptr, &works[i]));
+        auto res = napi_queue_async_work_with_queue(env, works[i], napi_qos_default, queueId);
+        ASSERT_EQ(res, i < acceptedCount ? napi_ok : napi_generic_failure);
+    }
+    napi_async_work_queue_stats full;
+    ASSERT_CHECK_CALL(napi_get_async_work_queue_stats(env, &full));
+    EXPECT_EQ(full.rejected - before.rejected, 1U);
+    EXPECT_EQ(full.pending - before.pending, acceptedCount);
+
+    runner.Run();
+    for (auto work : works) {
+        napi_delete_async_work(env, work);
+    }
+}
+
+/**
+ * @tc.name: NapiQueueAsyncWorkWithQueueTest012
+ * @tc.desc: Test an ordered work completes while the later works of its drain still run
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiBasicTest, NapiQueueAsyncWorkWithQueueTest012, testing::ext::TestSize.Level1)
+{
+    static constexpr auto waitLimit = std::chrono::seconds(5);
+    struct OrderedContext {
+        napi_async_work blocker = nullptr;
+        napi_async_work first = nullptr;
+        napi_async_work last = nullptr;
+        std::atomic<bool> queued {false};
+        std::atomic<bool> firstCompleted {false};
+        bool seenByLast = false;
+    };
+    UVLoopRunner runner(engine_);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value resourceName = nullptr;
+    napi_create_string_utf8(env, TEST_CHAR_ASYNCWORK, NAPI_AUTO_LENGTH, &resourceName);
+    uintptr_t queueId = reinterpret_cast<uintptr_t>(&resourceName);
+
+    OrderedContext context;
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+        [](napi_env env, void* data) {
+            auto context = reinterpret_cast<OrderedContext*>(data);
+            auto begin = std::chrono::steady_clock::now();
+            while (!context->queued.load() && std::chrono::steady_clock::now() - begin < waitLimit) {
+                std::this_thread::yield();
+            }
+        },
+        [](napi_env env, napi_status status, void* data) {
+            auto context = reinterpret_cast<OrderedContext*>(data);
+            napi_delete_async_work(env, context->blocker);
+        },
+        &context, &context.blocker));
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+        [](napi_env env, void* data) {},
+        [](napi_env env, napi_status status, void* data) {
+            auto context = reinterpret_cast<OrderedContext*>(data);
+            EXPECT_EQ(status, napi_ok);
+            context->firstCompleted.store(true);
+            napi_delete_async_work(env, context->first);
+        },
+        &context, &context.first));
+    ASSERT_CHECK_CALL(napi_create_async_work(env, nullptr, resourceName,
+        [](napi_env env, void* data) {
+            auto context = reinterpret_cast<OrderedContext*>(data);
+            auto begin = std::chrono::steady_clock::now();
+            while (!context->firstCompleted.load() && std::chrono::steady_clock::now() - begin < waitLimit) {
+                std::this_thread::yield();
+            }
+            context->seenByLast = context->firstCompleted.load();
+        },
+        [](napi_env env, napi_status status, void* data) {
+            auto context = reinterpret_cast<OrderedContext*>(data);
+            EXPECT_EQ(status, napi_ok);
+            napi_delete_async_work(env, context->last);
+        },
+        &context, &context.last));
+    // the blocker holds the first drain, so the next drain takes both works together
+    ASSERT_CHECK_CALL(napi_queue_async_work_with_queue(env, context.blocker, napi_qos_default, queueId));
+    ASSERT_CHECK_CALL(napi_queue_async_work_with_queue(env, context.first, napi_qos_default, queueId));
+    ASSERT_CHECK_CALL(napi_queue_async_work_with_queue(env, context.last, napi_qos_default, queueId));
+    context.queued.store(true);
+    runner.Run();
+    EXPECT_TRUE(context.seenByLast);
+}
+
 static napi_value Func(napi_env env, napi_callback_info info)
 {
     napi_value num = nullptr;
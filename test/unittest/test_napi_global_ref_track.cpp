@@ -123,3 +123,47 @@ HWTEST_F(NapiGlobalRefTrackTest, TestDisableClearsAllMappings, testing::ext::Tes
 
     napi_delete_reference(env, ref);
 }
+
+HWTEST_F(NapiGlobalRefTrackTest, TestReferenceSamplingInvalidArgs, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    size_t length = 0;
+    ASSERT_EQ(napi_set_reference_sampling(nullptr, 1, false), napi_invalid_arg);
+    ASSERT_EQ(napi_dump_reference_sites(nullptr, 1, nullptr, 0, &length), napi_invalid_arg);
+    ASSERT_EQ(napi_dump_reference_sites(env, 1, nullptr, 0, nullptr), napi_invalid_arg);
+}
+
+HWTEST_F(NapiGlobalRefTrackTest, TestReferenceSamplingOutstanding, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t count = 10;
+    static constexpr size_t deleted = 4;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    ASSERT_EQ(napi_set_reference_sampling(env, 1, false), napi_ok);
+
+    napi_ref refs[count] = {nullptr};
+    for (size_t i = 0; i < count; i++) {
+        napi_value obj = nullptr;
+        napi_create_object(env, &obj);
+        ASSERT_EQ(napi_create_reference(env, obj, 1, &refs[i]), napi_ok);
+    }
+    for (size_t i = 0; i < deleted; i++) {
+        ASSERT_EQ(napi_delete_reference(env, refs[i]), napi_ok);
+    }
+
+    size_t length = 0;
+    ASSERT_EQ(napi_dump_reference_sites(env, 1, nullptr, 0, &length), napi_ok);
+    std::string dump(length + 1, '\0');
+    ASSERT_EQ(napi_dump_reference_sites(env, 1, dump.data(), dump.size(), &length), napi_ok);
+    dump.resize(length);
+    // every reference is sampled, the ones still alive are outstanding
+    ASSERT_NE(dump.find("reference sampling 1/1: " + std::to_string(count - deleted) + " outstanding"),
+              std::string::npos);
+
+    // stopping drops the samples, later references are not sampled
+    ASSERT_EQ(napi_set_reference_sampling(env, 0, false), napi_ok);
+    ASSERT_EQ(napi_dump_reference_sites(env, 1, dump.data(), dump.size(), &length), napi_ok);
+    ASSERT_NE(std::string(dump.data(), length).find(": 0 outstanding in 0 sites"), std::string::npos);
+    for (size_t i = deleted; i < count; i++) {
+        napi_delete_reference(env, refs[i]);
+    }
+}
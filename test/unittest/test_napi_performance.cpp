@@ -14,11 +14,16 @@
  */
 
 #include <ctime>
+#include <string>
+#include <string_view>
 #include <sys/time.h>
+#include <uv.h>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
+#include "napi/native_node_binding.h"
 #include "native_engine.h"
 #include "native_engine/impl/ark/ark_native_engine.h"
 
@@ -26,6 +31,21 @@ using panda::RuntimeOption;
 
 static constexpr int NUM_COUNT = 10000;
 static constexpr int TIME_UNIT = 1000000;
+static constexpr int ASYNC_JOB_COUNT = 1000000;
+static constexpr int ASYNC_JOB_WAVE = 10000;
+static constexpr int MODULE_METHOD_COUNT = 500;
+static constexpr int MODULE_LOAD_COUNT = 20;
+// keys of a JSON-like record read by marshaling code
+static constexpr const char* RECORD_KEYS[] = {
+    "id", "name", "type", "x", "y", "width", "height", "visible", "color", "children",
+};
+static napi_named_accessor g_recordAccessors[] = {
+    NAPI_NAMED_ACCESSOR(RECORD_KEYS[0]), NAPI_NAMED_ACCESSOR(RECORD_KEYS[1]), NAPI_NAMED_ACCESSOR(RECORD_KEYS[2]),
+    NAPI_NAMED_ACCESSOR(RECORD_KEYS[3]), NAPI_NAMED_ACCESSOR(RECORD_KEYS[4]), NAPI_NAMED_ACCESSOR(RECORD_KEYS[5]),
+    NAPI_NAMED_ACCESSOR(RECORD_KEYS[6]), NAPI_NAMED_ACCESSOR(RECORD_KEYS[7]), NAPI_NAMED_ACCESSOR(RECORD_KEYS[8]),
+    NAPI_NAMED_ACCESSOR(RECORD_KEYS[9]),
+};
+static constexpr size_t RECORD_KEY_COUNT = sizeof(RECORD_KEYS) / sizeof(RECORD_KEYS[0]);
 time_t g_timeFor = 0;
 struct timeval g_beginTime;
 struct timeval g_endTime;
@@ -90,8 +110,38 @@ public:
         }
     }
 
+    // Queue ASYNC_JOB_COUNT empty works with qos in waves, each wave is drained by the loop before the next one.
+    void RunTinyAsyncWorks()
+    {
+        napi_env env = (napi_env)nativeEngine_;
+        napi_value resourceName = nullptr;
+        napi_create_string_utf8(env, "tinyJob", NAPI_AUTO_LENGTH, &resourceName);
+        int completed = 0;
+        for (int wave = 0; wave < ASYNC_JOB_COUNT / ASYNC_JOB_WAVE; wave++) {
+            completed = 0;
+            for (int i = 0; i < ASYNC_JOB_WAVE; i++) {
+                napi_async_work work = nullptr;
+                napi_create_async_work(env, nullptr, resourceName, [](napi_env env, void* data) {},
+                    [](napi_env env, napi_status status, void* data) {
+                        int* completed = reinterpret_cast<int*>(data);
+                        if (++(*completed) == ASYNC_JOB_WAVE) {
+                            uv_stop(reinterpret_cast<NativeEngine*>(env)->GetUVLoop());
+                        }
+                    }, &completed, &work);
+                napi_queue_async_work_with_qos(env, work, napi_qos_default);
+                works_.push_back(work);
+            }
+            uv_run(nativeEngine_->GetUVLoop(), UV_RUN_DEFAULT);
+            for (auto work : works_) {
+                napi_delete_async_work(env, work);
+            }
+            works_.clear();
+        }
+    }
+
     EcmaVM* vm_ {nullptr};
     NativeEngine* nativeEngine_ {nullptr};
+    std::vector<napi_async_work> works_;
 };
 
 HWTEST_F(ArkNapiPerfomanceTest, GetBoolean001, testing::ext::TestSize.Level0)
@@ -376,6 +426,277 @@ HWTEST_F(ArkNapiPerfomanceTest, CreateFunction, testing::ext::TestSize.Level0)
     TEST_TIME(napi_create_function);
 }
 
+// Module loads defining MODULE_METHOD_COUNT methods each, half on the exports and half on a class.
+HWTEST_F(ArkNapiPerfomanceTest, DefineModuleMethods, testing::ext::TestSize.Level0)
+{
+    napi_env env = (napi_env)nativeEngine_;
+    std::vector<std::string> names;
+    std::vector<napi_property_descriptor> descriptors;
+    for (int i = 0; i < MODULE_METHOD_COUNT / 2; i++) {
+        names.emplace_back("method" + std::to_string(i));
+    }
+    for (const auto& name : names) {
+        descriptors.push_back({name.c_str(), nullptr, SayHello, nullptr, nullptr, nullptr, napi_default, nullptr});
+    }
+
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < MODULE_LOAD_COUNT; i++) {
+        napi_handle_scope scope = nullptr;
+        napi_open_handle_scope(env, &scope);
+        napi_value exports = nullptr;
+        napi_create_object(env, &exports);
+        napi_define_properties(env, exports, descriptors.size(), descriptors.data());
+        napi_value cls = nullptr;
+        napi_define_class(env, "Module", NAPI_AUTO_LENGTH, SayHello, nullptr, descriptors.size(), descriptors.data(),
+                          &cls);
+        napi_close_handle_scope(env, scope);
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(define_module_methods);
+}
+
+struct GeometryArgs {
+    double x;
+    double y;
+    int32_t width;
+    int32_t height;
+};
+
+napi_value UnpackGeometryByValue(napi_env env, napi_callback_info info)
+{
+    static constexpr size_t argCount = 4;
+    size_t argc = argCount;
+    napi_value argv[argCount] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+    GeometryArgs args;
+    napi_valuetype type = napi_undefined;
+    for (size_t i = 0; i < argCount; i++) {
+        napi_typeof(env, argv[i], &type);
+    }
+    napi_get_value_double(env, argv[0], &args.x);
+    napi_get_value_double(env, argv[1], &args.y);
+    napi_get_value_int32(env, argv[2], &args.width);
+    napi_get_value_int32(env, argv[3], &args.height);
+    return nullptr;
+}
+
+napi_value UnpackGeometryByFormat(napi_env env, napi_callback_info info)
+{
+    GeometryArgs args;
+    napi_get_cb_args(env, info, "ddii", &args.x, &args.y, &args.width, &args.height);
+    return nullptr;
+}
+
+void CallGeometryFunction(napi_env env, napi_callback callback)
+{
+    napi_value fn = nullptr;
+    napi_create_function(env, nullptr, 0, callback, nullptr, &fn);
+    napi_value argv[4] = { nullptr };
+    napi_create_double(env, 1.5, &argv[0]);
+    napi_create_double(env, 2.5, &argv[1]);
+    napi_create_int32(env, 100, &argv[2]);
+    napi_create_int32(env, 200, &argv[3]);
+    napi_value global = nullptr;
+    napi_get_global(env, &global);
+
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_call_function(env, global, fn, 4, argv, nullptr);
+    }
+    gettimeofday(&g_endTime, nullptr);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, UnpackArgsByValue, testing::ext::TestSize.Level0)
+{
+    CallGeometryFunction((napi_env)nativeEngine_, UnpackGeometryByValue);
+    TEST_TIME(napi_get_cb_info_and_get_value);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, UnpackArgsByFormat, testing::ext::TestSize.Level0)
+{
+    CallGeometryFunction((napi_env)nativeEngine_, UnpackGeometryByFormat);
+    TEST_TIME(napi_get_cb_args);
+}
+
+int32_t GeometryArea(double x, double y, int32_t width, int32_t height)
+{
+    return width * height;
+}
+
+uint32_t TextLength(std::string_view text)
+{
+    return static_cast<uint32_t>(text.size());
+}
+
+napi_value GeometryAreaByHand(napi_env env, napi_callback_info info)
+{
+    static constexpr size_t argCount = 4;
+    size_t argc = argCount;
+    napi_value argv[argCount] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr));
+    GeometryArgs args;
+    NAPI_CALL(env, napi_get_value_double(env, argv[0], &args.x));
+    NAPI_CALL(env, napi_get_value_double(env, argv[1], &args.y));
+    NAPI_CALL(env, napi_get_value_int32(env, argv[2], &args.width));
+    NAPI_CALL(env, napi_get_value_int32(env, argv[3], &args.height));
+    napi_value result = nullptr;
+    NAPI_CALL(env, napi_create_int32(env, GeometryArea(args.x, args.y, args.width, args.height), &result));
+    return result;
+}
+
+napi_value TextLengthByHand(napi_env env, napi_callback_info info)
+{
+    size_t argc = 1;
+    napi_value argv[1] = { nullptr };
+    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr));
+    size_t length = 0;
+    NAPI_CALL(env, napi_get_value_string_utf8(env, argv[0], nullptr, 0, &length));
+    std::string text(length, '\0');
+    NAPI_CALL(env, napi_get_value_string_utf8(env, argv[0], text.data(), length + 1, &length));
+    napi_value result = nullptr;
+    NAPI_CALL(env, napi_create_uint32(env, TextLength(text), &result));
+    return result;
+}
+
+void CallTextFunction(napi_env env, napi_callback callback)
+{
+    napi_value fn = nullptr;
+    napi_create_function(env, nullptr, 0, callback, nullptr, &fn);
+    napi_value argv[1] = { nullptr };
+    napi_create_string_utf8(env, "the quick brown fox jumps over the lazy dog", NAPI_AUTO_LENGTH, &argv[0]);
+    napi_value global = nullptr;
+    napi_get_global(env, &global);
+
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_call_function(env, global, fn, 1, argv, nullptr);
+    }
+    gettimeofday(&g_endTime, nullptr);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, BindNumbersByHand, testing::ext::TestSize.Level0)
+{
+    CallGeometryFunction((napi_env)nativeEngine_, GeometryAreaByHand);
+    TEST_TIME(hand_written_numbers);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, BindNumbersByTemplate, testing::ext::TestSize.Level0)
+{
+    CallGeometryFunction((napi_env)nativeEngine_, NapiBinding::Callback<GeometryArea>);
+    TEST_TIME(napi_binding_numbers);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, BindStringByHand, testing::ext::TestSize.Level0)
+{
+    CallTextFunction((napi_env)nativeEngine_, TextLengthByHand);
+    TEST_TIME(hand_written_string);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, BindStringByTemplate, testing::ext::TestSize.Level0)
+{
+    CallTextFunction((napi_env)nativeEngine_, NapiBinding::Callback<TextLength>);
+    TEST_TIME(napi_binding_string);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, GetNamedProperties, testing::ext::TestSize.Level0)
+{
+    napi_env env = (napi_env)nativeEngine_;
+    napi_value object = nullptr;
+    napi_create_object(env, &object);
+    napi_value value = nullptr;
+    napi_create_int32(env, 1, &value);
+    for (const char* name : RECORD_KEYS) {
+        napi_set_named_property(env, object, name, value);
+    }
+
+    napi_value result = nullptr;
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        for (const char* name : RECORD_KEYS) {
+            napi_get_named_property(env, object, name, &result);
+        }
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_get_named_property);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, GetNamedPropertiesCached, testing::ext::TestSize.Level0)
+{
+    napi_env env = (napi_env)nativeEngine_;
+    napi_value object = nullptr;
+    napi_create_object(env, &object);
+    napi_value value = nullptr;
+    napi_create_int32(env, 1, &value);
+    for (const char* name : RECORD_KEYS) {
+        napi_set_named_property(env, object, name, value);
+    }
+
+    napi_value result = nullptr;
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        for (auto& accessor : g_recordAccessors) {
+            napi_get_named_property_cached(env, object, &accessor, &result);
+        }
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_get_named_property_cached);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, GetNamedPropertiesBulk, testing::ext::TestSize.Level0)
+{
+    napi_env env = (napi_env)nativeEngine_;
+    napi_value object = nullptr;
+    napi_create_object(env, &object);
+    napi_value values[RECORD_KEY_COUNT] = { nullptr };
+    for (size_t i = 0; i < RECORD_KEY_COUNT; i++) {
+        napi_create_int32(env, 1, &values[i]);
+    }
+    napi_set_named_properties(env, object, RECORD_KEY_COUNT, g_recordAccessors, values);
+
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_get_named_properties(env, object, RECORD_KEY_COUNT, g_recordAccessors, values);
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_get_named_properties);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, SetNamedProperties, testing::ext::TestSize.Level0)
+{
+    napi_env env = (napi_env)nativeEngine_;
+    napi_value object = nullptr;
+    napi_create_object(env, &object);
+    napi_value value = nullptr;
+    napi_create_int32(env, 1, &value);
+
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        for (const char* name : RECORD_KEYS) {
+            napi_set_named_property(env, object, name, value);
+        }
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_set_named_property);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, SetNamedPropertiesBulk, testing::ext::TestSize.Level0)
+{
+    napi_env env = (napi_env)nativeEngine_;
+    napi_value object = nullptr;
+    napi_create_object(env, &object);
+    napi_value values[RECORD_KEY_COUNT] = { nullptr };
+    for (size_t i = 0; i < RECORD_KEY_COUNT; i++) {
+        napi_create_int32(env, static_cast<int32_t>(i), &values[i]);
+    }
+
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_set_named_properties(env, object, RECORD_KEY_COUNT, g_recordAccessors, values);
+    }
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_set_named_properties);
+}
+
 HWTEST_F(ArkNapiPerfomanceTest, CreateError, testing::ext::TestSize.Level0)
 {
     napi_env env = (napi_env)nativeEngine_;
@@ -639,3 +960,59 @@ HWTEST_F(ArkNapiPerfomanceTest, SetNameProperty, testing::ext::TestSize.Level0)
     gettimeofday(&g_endTime, nullptr);
     TEST_TIME(napi_set_named_property);
 }
+
+// Gets of the same strong handle, against GetReferenceValue for a napi_ref.
+HWTEST_F(ArkNapiPerfomanceTest, GetStrongHandleValue, testing::ext::TestSize.Level0)
+{
+    napi_env env = (napi_env)nativeEngine_;
+    napi_value object = nullptr;
+    napi_create_object(env, &object);
+    napi_strong_handle handle = 0;
+    napi_create_strong_handle(env, object, &handle);
+
+    napi_value result = nullptr;
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_get_strong_handle_value(env, handle, &result);
+    }
+    gettimeofday(&g_endTime, nullptr);
+    napi_delete_strong_handle(env, handle);
+    TEST_TIME(napi_get_strong_handle_value);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, GetReferenceValue, testing::ext::TestSize.Level0)
+{
+    napi_env env = (napi_env)nativeEngine_;
+    napi_value object = nullptr;
+    napi_create_object(env, &object);
+    napi_ref ref = nullptr;
+    napi_create_reference(env, object, 1, &ref);
+
+    napi_value result = nullptr;
+    gettimeofday(&g_beginTime, nullptr);
+    for (int i = 0; i < NUM_COUNT; i++) {
+        napi_get_reference_value(env, ref, &result);
+    }
+    gettimeofday(&g_endTime, nullptr);
+    napi_delete_reference(env, ref);
+    TEST_TIME(napi_get_reference_value);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, QueueAsyncWorkWithQosOnUvPool, testing::ext::TestSize.Level0)
+{
+    gettimeofday(&g_beginTime, nullptr);
+    RunTinyAsyncWorks();
+    gettimeofday(&g_endTime, nullptr);
+    TEST_TIME(napi_queue_async_work_with_qos_uv_pool);
+}
+
+HWTEST_F(ArkNapiPerfomanceTest, QueueAsyncWorkWithQosOnStealingPool, testing::ext::TestSize.Level0)
+{
+    napi_env env = (napi_env)nativeEngine_;
+    napi_start_async_work_pool(env, 0);
+    gettimeofday(&g_beginTime, nullptr);
+    RunTinyAsyncWorks();
+    gettimeofday(&g_endTime, nullptr);
+    napi_stop_async_work_pool(env);
+    TEST_TIME(napi_queue_async_work_with_qos_stealing_pool);
+}
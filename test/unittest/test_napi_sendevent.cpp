@@ -19,6 +19,7 @@
 #include "napi/native_api.h"
 #include "napi/native_node_api.h"
 #include "native_engine.h"
+#include "native_event.h"
 
 static char g_defaultName[] = "defaultName";
 static char g_defaultData[] = "testData";
@@ -399,4 +400,150 @@ HWTEST_F(NapiSendEventTest, CancelEvent003, testing::ext::TestSize.Level1)
     ASSERT_NE(handleId, 0);
     auto result = napi_cancel_event(env, handleId, g_defaultName);
     ASSERT_EQ(result, napi_status::napi_ok);
-}
\ No newline at end of file
+}
+
+/**
+ * @tc.name: EventWakeupStats001
+ * @tc.desc: Test napi_get_event_wakeup_stats invalidParams
+ * @tc.type:FUNC
+ */
+HWTEST_F(NapiSendEventTest, EventWakeupStats001, testing::ext::TestSize.Level1)
+{
+    ASSERT_NE(engine_, nullptr);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    uint64_t sent = 0;
+    uint64_t elided = 0;
+    ASSERT_EQ(napi_get_event_wakeup_stats(nullptr, &sent, &elided), napi_status::napi_invalid_arg);
+    ASSERT_EQ(napi_get_event_wakeup_stats(env, nullptr, &elided), napi_status::napi_invalid_arg);
+    ASSERT_EQ(napi_get_event_wakeup_stats(env, &sent, nullptr), napi_status::napi_invalid_arg);
+}
+
+/**
+ * @tc.name: EventWakeupStats002
+ * @tc.desc: Test events sent by uv are counted as sent or elided wakeups
+ * @tc.type:FUNC
+ */
+HWTEST_F(NapiSendEventTest, EventWakeupStats002, testing::ext::TestSize.Level1)
+{
+    ASSERT_NE(engine_, nullptr);
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    uint64_t sentBefore = 0;
+    uint64_t elidedBefore = 0;
+    ASSERT_EQ(napi_get_event_wakeup_stats(env, &sentBefore, &elidedBefore), napi_status::napi_ok);
+
+    constexpr int eventCount = 10;
+    for (int i = 0; i < eventCount; i++) {
+        uint64_t handleId = 0;
+        ASSERT_EQ(napi_send_cancelable_event(env, Task, g_defaultData, napi_eprio_high, &handleId, g_defaultName),
+            napi_status::napi_ok);
+    }
+
+    uint64_t sent = 0;
+    uint64_t elided = 0;
+    ASSERT_EQ(napi_get_event_wakeup_stats(env, &sent, &elided), napi_status::napi_ok);
+    EXPECT_GE(sent, sentBefore);
+    EXPECT_GE(elided, elidedBefore);
+    EXPECT_LE(sent - sentBefore, 1);
+    engine_->Loop(LOOP_NOWAIT);
+}
+
+class UvOnlyEvent : public NativeEvent {
+public:
+    explicit UvOnlyEvent(NativeEngine* engine, napi_value name)
+        : NativeEvent(engine, nullptr, nullptr, name, 0, 1, nullptr, nullptr, nullptr, CallJs)
+    {
+#if defined(ENABLE_EVENT_HANDLER)
+        eventHandler_ = nullptr;
+#endif
+    }
+
+    static void CallJs(NativeEngine* engine, napi_value jsCallback, void* context, void* data)
+    {
+        static_cast<NativeEvent*>(context)->RunNextEvent();
+    }
+};
+
+static UvOnlyEvent* CreateUvOnlyEvent(NativeEngine* engine)
+{
+    napi_value name = nullptr;
+    napi_create_string_utf8(reinterpret_cast<napi_env>(engine), "UvOnlyEvent", NAPI_AUTO_LENGTH, &name);
+    auto event = new UvOnlyEvent(engine, name);
+    EXPECT_TRUE(event->Init());
+    return event;
+}
+
+static void CloseUvOnlyEvent(NativeEngine* engine, UvOnlyEvent* event)
+{
+    napi_release_threadsafe_function(reinterpret_cast<napi_threadsafe_function>(event), napi_tsfn_abort);
+    engine->Loop(LOOP_NOWAIT);
+}
+
+/**
+ * @tc.name: UvEventPriority001
+ * @tc.desc: Test events of the uv path run by priority instead of arrival order
+ * @tc.type:FUNC
+ */
+HWTEST_F(NapiSendEventTest, UvEventPriority001, testing::ext::TestSize.Level1)
+{
+    ASSERT_NE(engine_, nullptr);
+    auto event = CreateUvOnlyEvent(engine_);
+    std::vector<int32_t> order;
+    const int32_t priorities[] = { napi_eprio_idle, napi_eprio_low, napi_eprio_high, napi_eprio_immediate,
+                                   napi_eprio_vip };
+    for (int32_t priority : priorities) {
+        uint64_t handleId = 0;
+        auto cb = [&order, priority](void*) { order.push_back(priority); };
+        ASSERT_EQ(event->SendCancelableEvent(cb, nullptr, priority, g_defaultName, &handleId), napi_ok);
+        ASSERT_NE(handleId, 0);
+    }
+    engine_->Loop(LOOP_NOWAIT);
+    std::vector<int32_t> expected = { napi_eprio_vip, napi_eprio_immediate, napi_eprio_high, napi_eprio_low,
+                                      napi_eprio_idle };
+    EXPECT_EQ(order, expected);
+    CloseUvOnlyEvent(engine_, event);
+}
+
+/**
+ * @tc.name: UvEventPriority002
+ * @tc.desc: Test a low priority event is not starved by a burst of vip events
+ * @tc.type:FUNC
+ */
+HWTEST_F(NapiSendEventTest, UvEventPriority002, testing::ext::TestSize.Level1)
+{
+    ASSERT_NE(engine_, nullptr);
+    auto event = CreateUvOnlyEvent(engine_);
+    constexpr int vipCount = 40;
+    constexpr int starvationLimit = 16;
+    std::vector<int32_t> order;
+    uint64_t handleId = 0;
+    auto idleCb = [&order](void*) { order.push_back(napi_eprio_idle); };
+    ASSERT_EQ(event->SendCancelableEvent(idleCb, nullptr, napi_eprio_idle, g_defaultName, &handleId), napi_ok);
+    for (int i = 0; i < vipCount; i++) {
+        auto vipCb = [&order](void*) { order.push_back(napi_eprio_vip); };
+        ASSERT_EQ(event->SendCancelableEvent(vipCb, nullptr, napi_eprio_vip, g_defaultName, &handleId), napi_ok);
+    }
+    engine_->Loop(LOOP_NOWAIT);
+    ASSERT_EQ(order.size(), vipCount + 1);
+    EXPECT_EQ(order[starvationLimit], napi_eprio_idle);
+    CloseUvOnlyEvent(engine_, event);
+}
+
+/**
+ * @tc.name: UvEventCancel001
+ * @tc.desc: Test events of the uv path are cancelled by handleId only once
+ * @tc.type:FUNC
+ */
+HWTEST_F(NapiSendEventTest, UvEventCancel001, testing::ext::TestSize.Level1)
+{
+    ASSERT_NE(engine_, nullptr);
+    auto event = CreateUvOnlyEvent(engine_);
+    bool called = false;
+    uint64_t handleId = 0;
+    auto cb = [&called](void*) { called = true; };
+    ASSERT_EQ(event->SendCancelableEvent(cb, nullptr, napi_eprio_high, g_defaultName, &handleId), napi_ok);
+    EXPECT_EQ(event->UvCancelEvent(handleId), SafeAsyncCode::SAFE_ASYNC_OK);
+    EXPECT_EQ(event->UvCancelEvent(handleId), SafeAsyncCode::SAFE_ASYNC_FAILED);
+    engine_->Loop(LOOP_NOWAIT);
+    EXPECT_FALSE(called);
+    CloseUvOnlyEvent(engine_, event);
+}
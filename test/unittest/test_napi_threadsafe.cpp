@@ -1723,4 +1723,258 @@ HWTEST_F(NapiThreadsafeTest, ThreadsafeTest018, testing::ext::TestSize.Level1)
     uv_register_task_to_worker(loop, HighPrioTask);
     napi_release_threadsafe_function(tsFunc, napi_tsfn_release);
     HILOG_INFO("ThreadsafeTest018 end");
-}
\ No newline at end of file
+}
+
+static constexpr int32_t BATCH_SEND_COUNT = 100;
+static int32_t g_batchReceiveCount = 0;
+static int32_t g_batchCallCount = 0;
+
+static void BatchTsFuncCallJs(napi_env env, napi_value tsfn_cb, void* context, void* data)
+{
+    ADD_FAILURE() << "per-item callback should not be called in batch mode";
+}
+
+static void BatchTsFuncCallJsBatch(napi_env env, napi_value tsfn_cb, void* context, void** data, size_t count)
+{
+    if (env == nullptr) {
+        return;
+    }
+    EXPECT_GT(count, 0);
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(reinterpret_cast<intptr_t>(data[i]), g_batchReceiveCount);
+        g_batchReceiveCount++;
+    }
+    g_batchCallCount++;
+}
+
+/**
+ * @tc.name: ThreadsafeBatchTest001
+ * @tc.desc: Test napi_set_threadsafe_function_batch_callback with invalid args.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeBatchTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_value name = nullptr;
+    ASSERT_EQ(napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &name), napi_ok);
+    napi_threadsafe_function tsFunc = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function(env, nullptr, nullptr, name,
+        0, 1, nullptr, nullptr, nullptr, BatchTsFuncCallJs, &tsFunc), napi_ok);
+    AutoTsfn tsfn(tsFunc);
+
+    EXPECT_EQ(napi_set_threadsafe_function_batch_callback(nullptr, tsFunc, BatchTsFuncCallJsBatch),
+        napi_invalid_arg);
+    EXPECT_EQ(napi_set_threadsafe_function_batch_callback(env, nullptr, BatchTsFuncCallJsBatch), napi_invalid_arg);
+    EXPECT_EQ(napi_set_threadsafe_function_batch_callback(env, tsFunc, nullptr), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: ThreadsafeBatchTest002
+ * @tc.desc: Test items sent by another thread are drained in batches and keep their order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeBatchTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    g_batchReceiveCount = 0;
+    g_batchCallCount = 0;
+    napi_value name = nullptr;
+    ASSERT_EQ(napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &name), napi_ok);
+    napi_threadsafe_function tsFunc = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function(env, nullptr, nullptr, name,
+        0, 1, nullptr, nullptr, nullptr, BatchTsFuncCallJs, &tsFunc), napi_ok);
+    ASSERT_EQ(napi_set_threadsafe_function_batch_callback(env, tsFunc, BatchTsFuncCallJsBatch), napi_ok);
+
+    std::thread producer([tsFunc]() {
+        for (intptr_t i = 0; i < BATCH_SEND_COUNT; i++) {
+            EXPECT_EQ(napi_call_threadsafe_function(tsFunc, reinterpret_cast<void*>(i), napi_tsfn_blocking),
+                napi_ok);
+        }
+    });
+    producer.join();
+
+    uv_loop_t* loop = engine_->GetUVLoop();
+    uv_run(loop, UV_RUN_NOWAIT);
+    EXPECT_EQ(g_batchReceiveCount, BATCH_SEND_COUNT);
+    EXPECT_LT(g_batchCallCount, BATCH_SEND_COUNT);
+    EXPECT_EQ(napi_release_threadsafe_function(tsFunc, napi_tsfn_release), napi_ok);
+    uv_run(loop, UV_RUN_NOWAIT);
+}
+
+/**
+ * @tc.name: ThreadsafeWakeupTest001
+ * @tc.desc: Test posts made while a wakeup is pending skip uv_async_send.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeWakeupTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    g_batchReceiveCount = 0;
+    g_batchCallCount = 0;
+    napi_value name = nullptr;
+    ASSERT_EQ(napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &name), napi_ok);
+    napi_threadsafe_function tsFunc = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function(env, nullptr, nullptr, name,
+        0, 1, nullptr, nullptr, nullptr, BatchTsFuncCallJs, &tsFunc), napi_ok);
+    ASSERT_EQ(napi_set_threadsafe_function_batch_callback(env, tsFunc, BatchTsFuncCallJsBatch), napi_ok);
+
+    uint64_t sent = 0;
+    uint64_t elided = 0;
+    EXPECT_EQ(napi_get_threadsafe_function_wakeup_stats(nullptr, &sent, &elided), napi_invalid_arg);
+    EXPECT_EQ(napi_get_threadsafe_function_wakeup_stats(tsFunc, nullptr, &elided), napi_invalid_arg);
+
+    std::thread producer([tsFunc]() {
+        for (intptr_t i = 0; i < BATCH_SEND_COUNT; i++) {
+            EXPECT_EQ(napi_call_threadsafe_function(tsFunc, reinterpret_cast<void*>(i), napi_tsfn_nonblocking),
+                napi_ok);
+        }
+    });
+    producer.join();
+    ASSERT_EQ(napi_get_threadsafe_function_wakeup_stats(tsFunc, &sent, &elided), napi_ok);
+    EXPECT_EQ(sent, 1);
+    EXPECT_EQ(elided, BATCH_SEND_COUNT - 1);
+
+    uv_loop_t* loop = engine_->GetUVLoop();
+    uv_run(loop, UV_RUN_NOWAIT);
+    EXPECT_EQ(g_batchReceiveCount, BATCH_SEND_COUNT);
+
+    // the drain cleared the pending flag, the next post wakes the loop again
+    EXPECT_EQ(napi_call_threadsafe_function(tsFunc, reinterpret_cast<void*>(BATCH_SEND_COUNT),
+        napi_tsfn_nonblocking), napi_ok);
+    ASSERT_EQ(napi_get_threadsafe_function_wakeup_stats(tsFunc, &sent, &elided), napi_ok);
+    EXPECT_EQ(sent, 2);
+    uv_run(loop, UV_RUN_NOWAIT);
+    EXPECT_EQ(napi_release_threadsafe_function(tsFunc, napi_tsfn_release), napi_ok);
+    uv_run(loop, UV_RUN_NOWAIT);
+}
+
+struct InlinePayload {
+    int32_t seq = 0;
+    char tag[16] = { 0 };
+};
+
+static constexpr int32_t INLINE_PAYLOAD_SEND_COUNT = 200;
+static constexpr size_t INLINE_PAYLOAD_QUEUE_SIZE = 4;
+static int32_t g_inlinePayloadReceived = 0;
+
+static void InlinePayloadCallJs(napi_env env, napi_value tsfn_cb, void* context, void* data)
+{
+    if (env == nullptr) {
+        return;
+    }
+    ASSERT_NE(data, nullptr);
+    auto payload = static_cast<InlinePayload*>(data);
+    EXPECT_EQ(payload->seq, g_inlinePayloadReceived);
+    EXPECT_STREQ(payload->tag, "payload");
+    g_inlinePayloadReceived++;
+}
+
+static void InlinePayloadCallJsBatch(napi_env env, napi_value tsfn_cb, void* context, void** data, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        InlinePayloadCallJs(env, tsfn_cb, context, data[i]);
+    }
+}
+
+static void SendInlinePayloads(napi_threadsafe_function tsFunc)
+{
+    InlinePayload payload;
+    ASSERT_EQ(strcpy_s(payload.tag, sizeof(payload.tag), "payload"), EOK);
+    for (int32_t i = 0; i < INLINE_PAYLOAD_SEND_COUNT; i++) {
+        payload.seq = i;
+        EXPECT_EQ(napi_call_threadsafe_function_with_payload(tsFunc, &payload, napi_tsfn_blocking), napi_ok);
+    }
+}
+
+/**
+ * @tc.name: ThreadsafeInlinePayloadTest001
+ * @tc.desc: Test inline payloads are copied per call and delivered in order through a small queue.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeInlinePayloadTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    g_inlinePayloadReceived = 0;
+    napi_value name = nullptr;
+    ASSERT_EQ(napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &name), napi_ok);
+    napi_threadsafe_function tsFunc = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function_with_inline_payload(env, nullptr, nullptr, name,
+        INLINE_PAYLOAD_QUEUE_SIZE, 1, nullptr, nullptr, nullptr, InlinePayloadCallJs, sizeof(InlinePayload),
+        &tsFunc), napi_ok);
+
+    std::thread producer(SendInlinePayloads, tsFunc);
+    uv_loop_t* loop = engine_->GetUVLoop();
+    while (g_inlinePayloadReceived < INLINE_PAYLOAD_SEND_COUNT) {
+        uv_run(loop, UV_RUN_NOWAIT);
+        std::this_thread::yield();
+    }
+    producer.join();
+    EXPECT_EQ(g_inlinePayloadReceived, INLINE_PAYLOAD_SEND_COUNT);
+    EXPECT_EQ(napi_release_threadsafe_function(tsFunc, napi_tsfn_release), napi_ok);
+    uv_run(loop, UV_RUN_NOWAIT);
+}
+
+/**
+ * @tc.name: ThreadsafeInlinePayloadTest002
+ * @tc.desc: Test payload slots are recycled after every batch drain.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeInlinePayloadTest002, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    g_inlinePayloadReceived = 0;
+    napi_value name = nullptr;
+    ASSERT_EQ(napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &name), napi_ok);
+    napi_threadsafe_function tsFunc = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function_with_inline_payload(env, nullptr, nullptr, name,
+        INLINE_PAYLOAD_QUEUE_SIZE, 1, nullptr, nullptr, nullptr, InlinePayloadCallJs, sizeof(InlinePayload),
+        &tsFunc), napi_ok);
+    ASSERT_EQ(napi_set_threadsafe_function_batch_callback(env, tsFunc, InlinePayloadCallJsBatch), napi_ok);
+
+    std::thread producer(SendInlinePayloads, tsFunc);
+    uv_loop_t* loop = engine_->GetUVLoop();
+    while (g_inlinePayloadReceived < INLINE_PAYLOAD_SEND_COUNT) {
+        uv_run(loop, UV_RUN_NOWAIT);
+        std::this_thread::yield();
+    }
+    producer.join();
+    EXPECT_EQ(g_inlinePayloadReceived, INLINE_PAYLOAD_SEND_COUNT);
+    EXPECT_EQ(napi_release_threadsafe_function(tsFunc, napi_tsfn_release), napi_ok);
+    uv_run(loop, UV_RUN_NOWAIT);
+}
+
+/**
+ * @tc.name: ThreadsafeInlinePayloadTest003
+ * @tc.desc: Test invalid arguments of inline payload threadsafe functions.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeTest, ThreadsafeInlinePayloadTest003, testing::ext::TestSize.Level1)
+{
+    napi_env env = (napi_env)engine_;
+    napi_value name = nullptr;
+    ASSERT_EQ(napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &name), napi_ok);
+    napi_threadsafe_function tsFunc = nullptr;
+    EXPECT_EQ(napi_create_threadsafe_function_with_inline_payload(env, nullptr, nullptr, name,
+        INLINE_PAYLOAD_QUEUE_SIZE, 1, nullptr, nullptr, nullptr, InlinePayloadCallJs, 0, &tsFunc), napi_invalid_arg);
+    EXPECT_EQ(napi_create_threadsafe_function_with_inline_payload(env, nullptr, nullptr, name,
+        INLINE_PAYLOAD_QUEUE_SIZE, 1, nullptr, nullptr, nullptr, InlinePayloadCallJs,
+        NativeSafeAsyncWork::MAX_INLINE_PAYLOAD_SIZE + 1, &tsFunc), napi_invalid_arg);
+    EXPECT_EQ(napi_create_threadsafe_function_with_inline_payload(env, nullptr, nullptr, name,
+        0, 1, nullptr, nullptr, nullptr, InlinePayloadCallJs, sizeof(InlinePayload), &tsFunc), napi_invalid_arg);
+
+    ASSERT_EQ(napi_create_threadsafe_function_with_inline_payload(env, nullptr, nullptr, name,
+        INLINE_PAYLOAD_QUEUE_SIZE, 1, nullptr, nullptr, nullptr, InlinePayloadCallJs, sizeof(InlinePayload),
+        &tsFunc), napi_ok);
+    InlinePayload payload;
+    EXPECT_EQ(napi_call_threadsafe_function_with_payload(tsFunc, nullptr, napi_tsfn_nonblocking), napi_invalid_arg);
+    EXPECT_EQ(napi_call_threadsafe_function(tsFunc, &payload, napi_tsfn_nonblocking), napi_invalid_arg);
+    EXPECT_EQ(napi_release_threadsafe_function(tsFunc, napi_tsfn_release), napi_ok);
+
+    napi_threadsafe_function plainFunc = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function(env, nullptr, nullptr, name,
+        INLINE_PAYLOAD_QUEUE_SIZE, 1, nullptr, nullptr, nullptr, InlinePayloadCallJs, &plainFunc), napi_ok);
+    EXPECT_EQ(napi_call_threadsafe_function_with_payload(plainFunc, &payload, napi_tsfn_nonblocking),
+        napi_invalid_arg);
+    EXPECT_EQ(napi_release_threadsafe_function(plainFunc, napi_tsfn_release), napi_ok);
+    uv_run(engine_->GetUVLoop(), UV_RUN_NOWAIT);
+}
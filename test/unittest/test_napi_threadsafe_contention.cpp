@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <uv.h>
+
+#include "napi/native_api.h"
+#include "napi/native_node_api.h"
+#include "utils/log.h"
+
+static constexpr size_t CONTENTION_PRODUCER_COUNT = 16;
+static constexpr size_t CONTENTION_SEND_PER_PRODUCER = 20000;
+static constexpr size_t CONTENTION_MAX_QUEUE_SIZE = 1024;
+
+static size_t g_contentionReceived = 0;
+// the loop is stopped once this many items arrived, 0 never stops it
+static size_t g_contentionTarget = 0;
+
+static void ContentionCallJs(napi_env env, napi_value jsCb, void* context, void* data)
+{
+    if (env != nullptr && ++g_contentionReceived == g_contentionTarget) {
+        uv_stop(reinterpret_cast<NativeEngine*>(env)->GetUVLoop());
+    }
+}
+
+class NapiThreadsafeContentionTest : public NativeEngineTest {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "NapiThreadsafeContentionTest SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "NapiThreadsafeContentionTest TearDownTestCase";
+    }
+
+    void SetUp() override {}
+    void TearDown() override {}
+
+    int64_t RunContention(napi_threadsafe_function_queue_type queueType, napi_threadsafe_function_call_mode mode);
+};
+
+// Returns the elapsed microseconds for all producers to hand their items to the loop thread.
+int64_t NapiThreadsafeContentionTest::RunContention(napi_threadsafe_function_queue_type queueType,
+                                                    napi_threadsafe_function_call_mode mode)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value name = nullptr;
+    napi_create_string_latin1(env, "ContentionBenchmark", NAPI_AUTO_LENGTH, &name);
+    napi_threadsafe_function tsfn = nullptr;
+    napi_status status = napi_create_threadsafe_function_with_queue_type(env, nullptr, nullptr, name,
+        CONTENTION_MAX_QUEUE_SIZE, 1, nullptr, nullptr, nullptr, ContentionCallJs, queueType, &tsfn);
+    EXPECT_EQ(status, napi_ok);
+    if (status != napi_ok) {
+        return -1;
+    }
+
+    g_contentionReceived = 0;
+    std::atomic<size_t> sent {0};
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (size_t i = 0; i < CONTENTION_PRODUCER_COUNT; i++) {
+        producers.emplace_back([tsfn, mode, &sent]() {
+            size_t count = 0;
+            while (count < CONTENTION_SEND_PER_PRODUCER) {
+                if (napi_call_threadsafe_function(tsfn, nullptr, mode) == napi_ok) {
+                    count++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            sent.fetch_add(count);
+        });
+    }
+
+    uv_loop_t* loop = engine_->GetUVLoop();
+    const size_t total = CONTENTION_PRODUCER_COUNT * CONTENTION_SEND_PER_PRODUCER;
+    // the loop sleeps until items arrive, the last one stops it
+    g_contentionTarget = total;
+    while (g_contentionReceived < total) {
+        uv_run(loop, UV_RUN_DEFAULT);
+    }
+    g_contentionTarget = 0;
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(sent.load(), total);
+    EXPECT_EQ(g_contentionReceived, total);
+    napi_release_threadsafe_function(tsfn, napi_tsfn_release);
+    uv_run(loop, UV_RUN_NOWAIT);
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+/**
+ * @tc.name: ThreadsafeContentionTest001
+ * @tc.desc: Compare blocking producers on the default queue and on the lock-free queue.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiThreadsafeContentionTest, ThreadsafeContentionTest001, testing::ext::TestSize.Level1)
+{
+    int64_t lockedTime = RunContention(napi_tsfn_queue_default, napi_tsfn_blocking);
+    int64_t lockFreeTime = RunContention(napi_tsfn_queue_lock_free, napi_tsfn_blocking);
+    GTEST_LOG_(INFO) << "blocking producers: " << CONTENTION_PRODUCER_COUNT << ", default queue = " << lockedTime
+                     << "us, lock-free queue = " << lockFreeTime << "us";
+}
+
+/**
+ * @tc.name: ThreadsafeContentionTest002
+ * @tc.desc: Compare non-blocking producers on the default queue and on the lock-free queue.
+ * @tc.type: PERF
+ */
+HWTEST_F(NapiThreadsafeContentionTest, ThreadsafeContentionTest002, testing::ext::TestSize.Level1)
+{
+    int64_t lockedTime = RunContention(napi_tsfn_queue_default, napi_tsfn_nonblocking);
+    int64_t lockFreeTime = RunContention(napi_tsfn_queue_lock_free, napi_tsfn_nonblocking);
+    GTEST_LOG_(INFO) << "non-blocking producers: " << CONTENTION_PRODUCER_COUNT << ", default queue = "
+                     << lockedTime << "us, lock-free queue = " << lockFreeTime << "us";
+}
+
+/**
+ * @tc.name: ThreadsafeLockFreeQueueTest001
+ * @tc.desc: Test the lock-free queue requires a bounded queue size.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeContentionTest, ThreadsafeLockFreeQueueTest001, testing::ext::TestSize.Level1)
+{
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value name = nullptr;
+    napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &name);
+    napi_threadsafe_function tsfn = nullptr;
+    EXPECT_EQ(napi_create_threadsafe_function_with_queue_type(env, nullptr, nullptr, name, 0, 1, nullptr, nullptr,
+        nullptr, ContentionCallJs, napi_tsfn_queue_lock_free, &tsfn), napi_invalid_arg);
+}
+
+/**
+ * @tc.name: ThreadsafeLockFreeQueueTest002
+ * @tc.desc: Test non-blocking calls on a full lock-free queue report napi_queue_full.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NapiThreadsafeContentionTest, ThreadsafeLockFreeQueueTest002, testing::ext::TestSize.Level1)
+{
+    static constexpr size_t maxQueueSize = 2;
+    napi_env env = reinterpret_cast<napi_env>(engine_);
+    napi_value name = nullptr;
+    napi_create_string_latin1(env, __func__, NAPI_AUTO_LENGTH, &name);
+    napi_threadsafe_function tsfn = nullptr;
+    ASSERT_EQ(napi_create_threadsafe_function_with_queue_type(env, nullptr, nullptr, name, maxQueueSize, 1, nullptr,
+        nullptr, nullptr, ContentionCallJs, napi_tsfn_queue_lock_free, &tsfn), napi_ok);
+
+    g_contentionReceived = 0;
+    for (size_t i = 0; i < maxQueueSize; i++) {
+        EXPECT_EQ(napi_call_threadsafe_function(tsfn, nullptr, napi_tsfn_nonblocking), napi_ok);
+    }
+    EXPECT_EQ(napi_call_threadsafe_function(tsfn, nullptr, napi_tsfn_nonblocking), napi_queue_full);
+
+    uv_loop_t* loop = engine_->GetUVLoop();
+    uv_run(loop, UV_RUN_NOWAIT);
+    EXPECT_EQ(g_contentionReceived, maxQueueSize);
+    EXPECT_EQ(napi_call_threadsafe_function(tsfn, nullptr, napi_tsfn_nonblocking), napi_ok);
+    EXPECT_EQ(napi_release_threadsafe_function(tsfn, napi_tsfn_release), napi_ok);
+    uv_run(loop, UV_RUN_NOWAIT);
+}